@@ -0,0 +1,182 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchTransport.hpp"
+
+#include <vector>
+
+using Register = ADS124S08::Register;
+using Address  = ADS124S08::Address;
+using INPMUX   = ADS124S08::INPMUX;
+using PGA	   = ADS124S08::PGA;
+using DATARATE = ADS124S08::DATARATE;
+using REF	   = ADS124S08::REF;
+
+static void rdata(benchmark::State &state) {
+	BenchTransport transport{};
+	ADS124S08	   adc{transport};
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(adc.rdata(false, false));
+	}
+}
+BENCHMARK(rdata);
+
+static void rdataStatusCrc(benchmark::State &state) {
+	BenchTransport transport{true, true};
+	ADS124S08	   adc{transport};
+
+	for (auto _ : state) {
+		const auto data = adc.rdata(true, true);
+		benchmark::DoNotOptimize(data);
+		benchmark::DoNotOptimize(data->crcValid());
+	}
+}
+BENCHMARK(rdataStatusCrc);
+
+static void rdataDirect(benchmark::State &state) {
+	BenchTransport transport{};
+	ADS124S08	   adc{transport};
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(adc.rdataDirect(false, false));
+	}
+}
+BENCHMARK(rdataDirect);
+
+static void rdataBatch(benchmark::State &state) {
+	BenchTransport transport{};
+	ADS124S08	   adc{transport};
+
+	const auto			  count = static_cast<std::size_t>(state.range(0));
+	std::vector<uint32_t> data(count);
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(adc.rdataBatch({data.data()}, count));
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(rdataBatch)->Arg(64)->Arg(1024);
+
+static void rdataInlineTransport(benchmark::State &state) {
+	BenchTransport				   transport{};
+	BasicADS124S08<BenchTransport> adc{transport};
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(adc.rdata(false, false));
+	}
+}
+BENCHMARK(rdataInlineTransport);
+
+static void rreg(benchmark::State &state) {
+	BenchTransport transport{};
+	ADS124S08	   adc{transport};
+
+	const auto count = static_cast<uint8_t>(state.range(0));
+	Register   buffer[ADS124S08::REGISTER_COUNT];
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(adc.rreg(Address::ID, count, buffer));
+	}
+}
+BENCHMARK(rreg)->Arg(1)->Arg(ADS124S08::REGISTER_COUNT);
+
+static void wreg(benchmark::State &state) {
+	BenchTransport transport{};
+	ADS124S08	   adc{transport};
+
+	// Alternate the values so that the register cache never elides the write
+	Register values[2u][4u] = {{0x12u, 0x08u, 0x1Eu, 0x02u}, {0x34u, 0x00u, 0x14u, 0x10u}};
+	uint8_t	 select			= 0u;
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(adc.wreg(Address::INP_MUX, 4u, values[select]));
+		select ^= 1u;
+	}
+}
+BENCHMARK(wreg);
+
+static void wregCached(benchmark::State &state) {
+	BenchTransport transport{};
+	ADS124S08	   adc{transport};
+
+	const Register values[4u] = {0x12u, 0x08u, 0x1Eu, 0x02u};
+	adc.wreg(Address::INP_MUX, 4u, values);
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(adc.wreg(Address::INP_MUX, 4u, values));
+	}
+}
+BENCHMARK(wregCached);
+
+template <typename REGISTER> static void setRegister(benchmark::State &state) {
+	BenchTransport transport{};
+	ADS124S08	   adc{transport};
+
+	// Two values differing in every bit, so that each iteration performs a WREG
+	const REGISTER values[2u] = {REGISTER{0x55u}, REGISTER{0xAAu}};
+	uint8_t		   select	  = 0u;
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(adc.setRegister(values[select]));
+		select ^= 1u;
+	}
+}
+BENCHMARK_TEMPLATE(setRegister, INPMUX);
+BENCHMARK_TEMPLATE(setRegister, PGA);
+BENCHMARK_TEMPLATE(setRegister, DATARATE);
+BENCHMARK_TEMPLATE(setRegister, REF);
+BENCHMARK_TEMPLATE(setRegister, ADS124S08::SYS);
+
+static void setRegisters(benchmark::State &state) {
+	BenchTransport transport{};
+	ADS124S08	   adc{transport};
+
+	const INPMUX   inpmux[2u]	= {INPMUX{0x12u}, INPMUX{0x34u}};
+	const PGA	   pga[2u]		= {PGA{0x08u}, PGA{0x00u}};
+	const DATARATE datarate[2u] = {DATARATE{0x1Eu}, DATARATE{0x14u}};
+	const REF	   ref[2u]		= {REF{0x02u}, REF{0x10u}};
+	uint8_t		   select		= 0u;
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(
+			adc.setRegisters({inpmux[select], pga[select], datarate[select], ref[select]})
+		);
+		select ^= 1u;
+	}
+}
+BENCHMARK(setRegisters);
+
+static void toVoltage(benchmark::State &state) {
+	ADS124S08::RDATA data{std::nullopt, 0x123456u, std::nullopt};
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(data.toVoltage(4.0f, 2.5f));
+		data.data = (data.data + 0x010101u) & 0xFFFFFFu;
+	}
+}
+BENCHMARK(toVoltage);
+
+static void toVoltages(benchmark::State &state) {
+	const auto			  count = static_cast<std::size_t>(state.range(0));
+	std::vector<uint32_t> codes(count);
+	std::vector<float>	  voltages(count);
+	for (std::size_t i = 0u; i < count; i++) {
+		codes[i] = static_cast<uint32_t>(i * 0x1111u) & 0xFFFFFFu;
+	}
+
+	for (auto _ : state) {
+		ADS124S08::RDATA::toVoltages(codes.data(), voltages.data(), count, 4.0f, 2.5f);
+		benchmark::DoNotOptimize(voltages.data());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(toVoltages)->Arg(1024);
+
+static void crc8(benchmark::State &state) {
+	const Register frame[4u] = {0x00u, 0x12u, 0x34u, 0x56u};
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(ADS124S08::CRC8::compute(frame, sizeof(frame)));
+	}
+}
+BENCHMARK(crc8);
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "ADS124S08.hpp"
+
+#include <algorithm>
+
+/**
+ * @brief In-process transport costing only a copy per transfer, so benchmarks measure the
+ * driver. Registers read as their address; conversions as 0x123456, preceded by STATUS 0x00 and
+ * followed by the CRC of the frame as configured.
+ */
+class BenchTransport final : public ADS124S08::SPI {
+public:
+	/**
+	 * @param statusByte Whether conversion frames include the STATUS byte.
+	 * @param crcByte Whether conversion frames include the CRC byte.
+	 */
+	explicit BenchTransport(bool statusByte = false, bool crcByte = false) noexcept {
+		if (statusByte) conversion[length++] = 0x00u;
+		conversion[length++] = 0x12u;
+		conversion[length++] = 0x34u;
+		conversion[length++] = 0x56u;
+		if (crcByte) {
+			conversion[length] = ADS124S08::CRC8::compute(conversion, length);
+			length++;
+		}
+
+		for (uint8_t i = 0u; i < ADS124S08::REGISTER_COUNT; i++) registers[i] = i;
+	}
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override {
+		std::fill_n(buffer, count, 0x00u);
+		return count;
+	}
+
+	std::optional<uint8_t> write(const Register *const, uint8_t count) noexcept override {
+		return count;
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>> readWrite(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count
+	) noexcept override {
+		if ((txBuffer[0] & 0xE0u) == 0x20u) {
+			const uint8_t address = txBuffer[0] & 0x1Fu;
+			const uint8_t values  = std::min<uint8_t>(count - 2u, REGISTER_COUNT - address);
+			std::copy_n(&registers[address], values, &rxBuffer[2]);
+		} else {
+			// RDATA frames are preceded by the command byte; direct reads are not
+			const bool	  command = txBuffer[0] == DataReadCommand::RDATA;
+			const uint8_t offset  = command ? 1u : 0u;
+			std::copy_n(conversion, std::min<uint8_t>(count - offset, length), &rxBuffer[offset]);
+		}
+		return std::make_tuple(count, count);
+	}
+
+private:
+	static constexpr uint8_t REGISTER_COUNT = ADS124S08::REGISTER_COUNT;
+
+	Register registers[REGISTER_COUNT]{};
+	Register conversion[5u]{};
+	uint8_t	 length{0u};
+};
@@ -0,0 +1,45 @@
+#include "benchmark/benchmark.h"
+
+#include "ADS124S08.hpp"
+
+#include <vector>
+
+static bool appendReplayLog(void *context, const ADS124S08::Register *data, std::size_t count)
+	noexcept {
+	auto *const log = static_cast<std::vector<ADS124S08::Register> *>(context);
+	log->insert(log->end(), data, data + count);
+	return true;
+}
+
+// Replays a recorded session of RDATA reads with STATUS and CRC, as when profiling on field data
+static void replayConversions(benchmark::State &state) {
+	const auto samples = static_cast<std::size_t>(state.range(0));
+
+	std::vector<ADS124S08::Register> log{};
+	{
+		ADS124S08::Simulator	simulator{};
+		ADS124S08::RecordingSPI recording{simulator, appendReplayLog, &log};
+		recording.begin();
+
+		ADS124S08 adc{recording};
+		adc.setRegister(ADS124S08::SYS{}.setSendStatus(true).setCRCEnable(true));
+		adc.start();
+		for (std::size_t i = 0u; i < samples; i++) {
+			simulator.advanceToNextEvent();
+			adc.rdata();
+		}
+	}
+
+	ADS124S08::ReplaySPI replay{log.data(), log.size()};
+	for (auto _ : state) {
+		replay.rewind();
+		ADS124S08 adc{replay};
+		adc.setRegister(ADS124S08::SYS{}.setSendStatus(true).setCRCEnable(true));
+		adc.start();
+		for (std::size_t i = 0u; i < samples; i++) {
+			benchmark::DoNotOptimize(adc.rdata());
+		}
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * samples));
+}
+BENCHMARK(replayConversions)->Arg(4000);
@@ -0,0 +1,59 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchTransport.hpp"
+
+#include <array>
+
+using INPMUX	 = ADS124S08::INPMUX;
+using PGA	 = ADS124S08::PGA;
+using DATARATE = ADS124S08::DATARATE;
+using REF	 = ADS124S08::REF;
+
+static const std::array<ADS124S08::ScanChannel, 4u> SCAN_CHANNELS = {{
+	{INPMUX{0x01u}, PGA{0x08u}, DATARATE{0x1Eu}, REF{0x10u}},
+	{INPMUX{0x23u}, PGA{0x08u}, DATARATE{0x1Eu}, REF{0x10u}},
+	{INPMUX{0x45u}, PGA{0x0Bu}, DATARATE{0x1Eu}, REF{0x10u}},
+	{INPMUX{0x67u}, PGA{0x0Bu}, DATARATE{0x1Eu}, REF{0x02u}},
+}};
+
+// A full cycle: configuration WREGs and one RDATA per channel
+static void scanCycle(benchmark::State &state) {
+	BenchTransport transport{};
+	ADS124S08	   adc{transport};
+
+	ADS124S08::ScanSequencer<SCAN_CHANNELS.size()> sequencer{
+		adc, SCAN_CHANNELS.data(), SCAN_CHANNELS.size()
+	};
+	std::optional<ADS124S08::RDATA> results[SCAN_CHANNELS.size()];
+
+	// The transport always has a conversion ready
+	const auto waitReady = [](void *) noexcept { return true; };
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(sequencer.scan(results, waitReady));
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * SCAN_CHANNELS.size()));
+}
+BENCHMARK(scanCycle);
+
+// The same cycle against the simulator, which also decodes every frame
+static void scanCycleSimulated(benchmark::State &state) {
+	ADS124S08::Simulator simulator{};
+	ADS124S08			 adc{simulator};
+
+	ADS124S08::ScanSequencer<SCAN_CHANNELS.size()> sequencer{
+		adc, SCAN_CHANNELS.data(), SCAN_CHANNELS.size()
+	};
+	std::optional<ADS124S08::RDATA> results[SCAN_CHANNELS.size()];
+
+	const auto waitReady = [](void *context) noexcept {
+		return static_cast<ADS124S08::Simulator *>(context)->advanceToNextEvent();
+	};
+
+	adc.start();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(sequencer.scan(results, waitReady, &simulator));
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * SCAN_CHANNELS.size()));
+}
+BENCHMARK(scanCycleSimulated);
@@ -1,9 +1,13 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <initializer_list>
 #include <optional>
 #include <tuple>
+#include <utility>
 
 class ADS124S08 {
 public:
@@ -97,9 +101,37 @@ public:
 	};
 	using Address  = SPI::Address;
 	using Register = SPI::Register;
+	using Command  = SPI::Command;
+
+	static constexpr uint8_t REGISTER_COUNT = 18u; // Addresses 0x00 to 0x11
+
+	// Datasheet reset values, indexed by address. The ID register is device dependent.
+	static constexpr std::array<Register, REGISTER_COUNT> RESET_VALUES = {
+		0x00u, // ID
+		0x80u, // STATUS
+		0x01u, // INPMUX
+		0x00u, // PGA
+		0x14u, // DATARATE
+		0x10u, // REF
+		0x00u, // IDACMAG
+		0xFFu, // IDACMUX
+		0x00u, // VBIAS
+		0x10u, // SYS
+		0x00u, // OFCAL0
+		0x00u, // OFCAL1
+		0x00u, // OFCAL2
+		0x00u, // FSCAL0
+		0x00u, // FSCAL1
+		0x40u, // FSCAL2
+		0x00u, // GPIODAT
+		0x00u, // GPIOCON
+	};
 
 	struct SPI_Register_I;
 
+	template <uint8_t SHIFT, uint8_t WIDTH> struct RegisterField;
+	template <Address ADDRESS, Register RESET_VALUE, typename... FIELDS> struct RegisterDescriptor;
+
 	struct ID;
 	struct STATUS;
 	struct INPMUX;
@@ -119,12 +151,143 @@ public:
 	struct GPIODAT;
 	struct GPIOCON;
 
+	class FixedPointScale;
+	struct CRC8;
+	struct LatencyModel;
+	struct ScanChannel;
+
+	template <typename TRANSPORT> class SPIAdapter;
+	class AsyncSPI;
+	struct AsyncTransaction;
+	class SharedBus;
+	class ChipSelectSPI;
+	class SpidevSPI;
+	class InstrumentedSPI;
+	struct CaptureHeader;
+	class CaptureWriter;
+	class CaptureView;
+	class CaptureFile;
+	struct SPILog;
+	class RecordingSPI;
+	class ReplaySPI;
+	class Simulator;
+	class DataReady;
+	class EdgeDataReady;
+	class StatusDataReady;
+	template <std::size_t CAPACITY> class SampleQueue;
+	template <std::size_t CAPACITY> class Stream;
+	template <std::size_t MAX_CHANNELS> class ScanSequencer;
+	template <std::size_t MAX_DEVICES> class DeviceManager;
+	template <typename T> class Task;
+	class AwaitableADS124S08;
+
+	/**
+	 * @brief Counters describing the effect of the register shadow cache on WREG traffic.
+	 */
+	struct WriteStatistics {
+		uint32_t issuedWrites; // WREG transactions sent to the device
+		uint32_t elidedWrites; // WREG requests skipped as the device already held every value
+		uint32_t elidedBytes;  // Register bytes not sent, including those trimmed from a WREG
+	};
+
 private:
 	SPI &spi;
 
-	Register sysCache{0x80u};
+	/**
+	 * @brief Shadow copy of the register file, indexed by address.
+	 *
+	 * @note Bit n of `registerCacheValid` is set when `registerCache[n]` is known to match the
+	 * device. Volatile registers (ID, STATUS, GPIODAT) are stored but never marked valid.
+	 */
+	mutable std::array<Register, REGISTER_COUNT> registerCache;
+	mutable uint32_t							 registerCacheValid{0u};
+	mutable WriteStatistics						 writeStatistics{};
+
+	void invalidateCachedRange(Address startAddress, uint8_t count) const noexcept;
+	void restoreResetValues(void) const noexcept;
+	std::pair<uint8_t, uint8_t>
+	trimCachedWrite(Address startAddress, uint8_t count, const Register *const buffer)
+		const noexcept;
+	void updateCachedRange(Address startAddress, uint8_t count, const Register *const values)
+		const noexcept;
+	std::optional<uint8_t> writeStagedRegisters(
+		const std::array<Register, REGISTER_COUNT> &image, //
+		uint32_t									dirty
+	) const noexcept;
+
+public:
+	struct RDATA;
+	enum class DataReadMode : uint8_t;
+	struct RDATABatch;
+
+	/**
+	 * @brief Hook blocking until the next conversion is ready, e.g. until DRDY falls.
+	 *
+	 * @param context The user context passed alongside the hook.
+	 * @return `true` if a conversion is ready, `false` on timeout or error.
+	 */
+	using WaitReady = bool (*)(void *context) noexcept;
+
+protected:
+	static constexpr bool validAddressRange(Address startAddress, uint8_t count) noexcept {
+		return count >= 1u && count <= REGISTER_COUNT && startAddress + count <= REGISTER_COUNT;
+	}
+
+	static RDATA
+	decodeConversion(const Register *const frame, bool statusByte, bool crcByte) noexcept;
+
+	/**
+	 * @brief SPI transactions, templated on the transport.
+	 *
+	 * `ADS124S08` instantiates these with its virtual `SPI`, while `BasicADS124S08` instantiates
+	 * them with a concrete transport so that every transfer may be inlined. Defined in
+	 * "Private/BasicADS124S08.hpp".
+	 */
+	template <typename TRANSPORT>
+	static std::optional<Register> sendCommand(TRANSPORT &transport, Command command) noexcept;
+
+	template <typename TRANSPORT>
+	std::optional<Register> rregVia(
+		TRANSPORT	   &transport,
+		Address			startAddress,
+		uint8_t			count,
+		Register *const buffer
+	) const noexcept;
+
+	template <typename TRANSPORT>
+	std::optional<Register> wregVia(
+		TRANSPORT			 &transport,
+		Address				  startAddress,
+		uint8_t				  count,
+		const Register *const buffer
+	) const noexcept;
+
+	template <typename TRANSPORT>
+	std::optional<RDATA> rdataVia(
+		TRANSPORT		   &transport,
+		DataReadMode		mode,
+		std::optional<bool> statusEnabled,
+		std::optional<bool> crcEnabled
+	) const noexcept;
+
+	template <typename TRANSPORT>
+	std::size_t rdataBatchVia(
+		TRANSPORT		 &transport,
+		const RDATABatch &batch,
+		std::size_t		  count,
+		DataReadMode	  mode,
+		WaitReady		  waitReady,
+		void			 *context
+	) const noexcept;
 
 public:
+	/**
+	 * @brief Construct the driver and populate the register shadow cache.
+	 *
+	 * @param spi The SPI interface connected to the ADS124S08.
+	 * @note A single 18-register RREG is performed. If it fails the cache starts invalid and is
+	 * populated as registers are subsequently read or written.
+	 */
 	explicit ADS124S08(SPI &spi);
 
 	/**
@@ -190,9 +353,80 @@ public:
 	 *
 	 * @param reg A SPI_Register_I interface representing the register to set.
 	 * @return The register value written if successful, `std::nullopt` otherwise.
+	 * @note No SPI transaction is performed if the cached register already holds the value.
 	 */
 	std::optional<Register> setRegister(const SPI_Register_I &reg) const noexcept;
 
+	/**
+	 * @brief Set a register whose type is known at compile time.
+	 *
+	 * The address is taken from `REGISTER::Descriptor` and `toRegister()` is called without
+	 * virtual dispatch, so a constant register folds to a literal WREG byte.
+	 *
+	 * @tparam REGISTER The register struct, e.g. `INPMUX`. Other `SPI_Register_I`
+	 * implementations use the virtual overload.
+	 * @param reg The register to set.
+	 * @return The register value written if successful, `std::nullopt` otherwise.
+	 */
+	template <typename REGISTER, typename = typename REGISTER::Descriptor>
+	std::optional<Register> setRegister(const REGISTER &reg) const noexcept {
+		return wreg(REGISTER::Descriptor::address, reg.REGISTER::toRegister());
+	}
+
+	/**
+	 * @brief Set several registers using the fewest possible WREG transactions.
+	 *
+	 * Registers whose cached value already matches are skipped. The remaining addresses are
+	 * grouped into contiguous bursts, bridging any gaps where the cached value is known so that
+	 * the gap registers are rewritten with their current contents.
+	 *
+	 * @param regs An array of pointers to the registers to set. If an address appears more than
+	 * once, the last occurrence is written.
+	 * @param count The number of registers in `regs`.
+	 * @return The number of WREG transactions issued if successful, `std::nullopt` otherwise.
+	 * @note E.g. changing INPMUX, PGA, DATARATE and REF issues a single 6-byte WREG.
+	 */
+	std::optional<uint8_t>
+	setRegisters(const SPI_Register_I *const *const regs, uint8_t count) const noexcept;
+
+	std::optional<uint8_t>
+	setRegisters(std::initializer_list<std::reference_wrapper<const SPI_Register_I>> regs
+	) const noexcept;
+
+	/**
+	 * @brief Re-read all registers from the ADS124S08 into the shadow cache.
+	 *
+	 * @return The ID register value if successful, `std::nullopt` otherwise.
+	 * @note Performs a single 18-register RREG.
+	 */
+	std::optional<Register> refreshRegisterCache(void) noexcept;
+
+	/**
+	 * @brief Mark every cached register as unknown, forcing the next write to each to be sent.
+	 *
+	 * @note Use this if the device may have been modified outside of this driver, e.g. by an
+	 * external reset or another bus master.
+	 */
+	void invalidateRegisterCache(void) noexcept;
+
+	/**
+	 * @brief Get the cached value of a register without any SPI transaction.
+	 *
+	 * @param address The register address.
+	 * @return The cached value if it is known to match the device, `std::nullopt` otherwise.
+	 */
+	std::optional<Register> getCachedRegister(Address address) const noexcept;
+
+	/**
+	 * @brief Get the WREG counters accumulated since construction or the last reset.
+	 */
+	WriteStatistics getWriteStatistics(void) const noexcept { return writeStatistics; }
+
+	/**
+	 * @brief Zero the WREG counters.
+	 */
+	void resetWriteStatistics(void) noexcept { writeStatistics = WriteStatistics{}; }
+
 	/**
 	 * @brief RDATA structure returned by the rdata() method.
 	 *
@@ -206,11 +440,74 @@ public:
 		std::optional<Register> crc;
 
 		float toVoltage(float pgaGain = 1.0f, float vRef = 2.5f) const;
+
+		/**
+		 * @brief Check the CRC byte against the STATUS (if present) and data bytes.
+		 *
+		 * @return `true` if the CRC matches, `false` if not, `std::nullopt` if no CRC byte was
+		 * read.
+		 */
+		std::optional<bool> crcValid(void) const noexcept;
+
+		/**
+		 * @brief Convert an array of raw 24-bit codes to voltages.
+		 *
+		 * @param codes Raw 24-bit two's complement codes, as in `RDATA::data`.
+		 * @param voltages An array to store `count` voltages. May not alias `codes`.
+		 * @param count The number of codes to convert.
+		 * @param pgaGain The PGA gain.
+		 * @param vRef The reference voltage.
+		 * @note Uses AVX2, SSE2 or NEON where enabled at compile time, else a scalar loop.
+		 */
+		static void toVoltages(
+			const uint32_t *const codes,
+			float *const		  voltages,
+			std::size_t			  count,
+			float				  pgaGain = 1.0f,
+			float				  vRef	  = 2.5f
+		) noexcept;
+
+		static void toVoltages(
+			const uint32_t *const codes,
+			double *const		  voltages,
+			std::size_t			  count,
+			double				  pgaGain = 1.0,
+			double				  vRef	  = 2.5
+		) noexcept;
+
+		/**
+		 * @brief Convert packed 3-byte big-endian frames, as clocked out of the device, to
+		 * voltages.
+		 *
+		 * @param frames `3 * count` bytes of conversion data, most significant byte first.
+		 * @param voltages An array to store `count` voltages.
+		 * @param count The number of frames to convert.
+		 * @param pgaGain The PGA gain.
+		 * @param vRef The reference voltage.
+		 */
+		static void framesToVoltages(
+			const Register *const frames,
+			float *const		  voltages,
+			std::size_t			  count,
+			float				  pgaGain = 1.0f,
+			float				  vRef	  = 2.5f
+		) noexcept;
+
+		static void framesToVoltages(
+			const Register *const frames,
+			double *const		  voltages,
+			std::size_t			  count,
+			double				  pgaGain = 1.0,
+			double				  vRef	  = 2.5
+		) noexcept;
 	};
 
 	/**
 	 * @brief Perform the RDATA command to read conversion data from the ADS124S08.
 	 *
+	 * May be used at any time; the conversion result is held until the next conversion
+	 * completes.
+	 *
 	 * @param statusEnabled Status byte override. If std::nullopt, uses the cached STATUS
 	 * register value. Else force enable/disable.
 	 * @param crcEnabled CRC byte override. If std::nullopt, uses the cached CRC register value.
@@ -225,12 +522,220 @@ public:
 	) const noexcept;
 
 	/**
-	 * @brief Get the Status register and memorize it.
+	 * @brief Read conversion data directly, without sending the RDATA command.
+	 *
+	 * Once DRDY falls the conversion result is shifted out on the next SCLKs, so the frame is
+	 * clocked out with a single full-duplex transaction of NOP bytes.
+	 *
+	 * @param statusEnabled Status byte override. If std::nullopt, uses the cached STATUS
+	 * register value. Else force enable/disable.
+	 * @param crcEnabled CRC byte override. If std::nullopt, uses the cached CRC register value.
+	 * Else force enable/disable.
+	 *
+	 * @return The RDATA structure if successful, `std::nullopt` otherwise.
+	 * @attention Must only be called after DRDY falls and completed before the next conversion
+	 * is ready, otherwise the result may be corrupted.
+	 * @note Refer to the ADS124S08 §9.5.4.1 "Read Data Direct" for details.
+	 */
+	std::optional<RDATA> rdataDirect(
+		std::optional<bool> statusEnabled = std::nullopt,
+		std::optional<bool> crcEnabled	  = std::nullopt
+	) const noexcept;
+
+	/**
+	 * @brief Conversion read method used by acquisition helpers.
+	 */
+	enum class DataReadMode : uint8_t {
+		COMMAND, // RDATA command, see rdata()
+		DIRECT,	 // Read data direct, see rdataDirect()
+	};
+
+	/**
+	 * @brief Read conversion data using the given method.
+	 *
+	 * @param mode The read method.
+	 * @return The RDATA structure if successful, `std::nullopt` otherwise.
+	 */
+	std::optional<RDATA> rdata(DataReadMode mode) const noexcept {
+		if (mode == DataReadMode::DIRECT) return rdataDirect();
+		else return rdata();
+	}
+
+	/**
+	 * @brief Caller-provided struct-of-arrays storage for rdataBatch().
+	 *
+	 * Each array must hold at least as many entries as conversions requested. `status` and
+	 * `crc` may be `nullptr` to discard those bytes; they are only written when the byte is
+	 * enabled in the cached SYS register.
+	 *
+	 * @attention `data` entries are raw 24-bit two's complement values without sign extension.
+	 */
+	struct RDATABatch {
+		uint32_t *data;
+		Register *status = nullptr;
+		Register *crc	 = nullptr;
+	};
+
+	/**
+	 * @brief Read consecutive conversions into caller-provided arrays.
+	 *
+	 * The frame layout is determined once from the cached SYS register and the transmit frame
+	 * is built once, so the per-sample cost is one SPI transaction and the byte unpacking.
+	 *
+	 * @param batch The destination arrays.
+	 * @param count The number of conversions to read.
+	 * @param mode The conversion read method.
+	 * @param waitReady Called before each read to wait for the conversion. If `nullptr`, the
+	 * caller is responsible for pacing, e.g. when only ever reading the latest result.
+	 * @param context Passed to `waitReady`.
+	 * @return The number of conversions read. Fewer than `count` indicates a wait or SPI failure.
+	 */
+	std::size_t rdataBatch(
+		const RDATABatch &batch,
+		std::size_t		  count,
+		DataReadMode	  mode		= DataReadMode::COMMAND,
+		WaitReady		  waitReady = nullptr,
+		void			 *context	= nullptr
+	) const noexcept;
+
+	/**
+	 * @brief Called with each conversion read by `acquire()`.
+	 *
+	 * @param context The user context passed alongside the handler.
+	 * @param data The conversion read.
+	 * @return `true` to continue the acquisition, `false` to stop it.
+	 */
+	using ConversionHandler = bool (*)(void *context, const RDATA &data) noexcept;
+
+	/**
+	 * @brief Read exactly one conversion per DRDY edge.
+	 *
+	 * @param dataReady The data-ready source.
+	 * @param count The number of conversions to read.
+	 * @param handler Called with each conversion. May be `nullptr`.
+	 * @param context Passed to `handler`.
+	 * @param timeoutMicroseconds The maximum wait for each edge. `UINT32_MAX` waits forever.
+	 * @param mode The conversion read method.
+	 * @return The number of conversions read. Fewer than `count` indicates a timeout, an SPI
+	 * failure or a stop requested by `handler`.
+	 */
+	std::size_t acquire(
+		DataReady		 &dataReady,
+		std::size_t		  count,
+		ConversionHandler handler			  = nullptr,
+		void			 *context			  = nullptr,
+		uint32_t		  timeoutMicroseconds = UINT32_MAX,
+		DataReadMode	  mode				  = DataReadMode::COMMAND
+	) const noexcept;
+
+	/**
+	 * @brief Called once an asynchronous transfer has finished.
+	 *
+	 * @param context The user context passed alongside the callback.
+	 * @param success `true` if every byte was transferred.
+	 * @note May be called from interrupt context, or before the starting call returns.
+	 */
+	using AsyncCompletion = void (*)(void *context, bool success) noexcept;
+
+	/**
+	 * @brief Start sending a command without blocking.
+	 *
+	 * @param spi The asynchronous transport.
+	 * @param transaction Caller-owned frame storage. Must not be pending.
+	 * @param command The command to send.
+	 * @param completion Called when the transfer finishes. May be `nullptr` to poll instead.
+	 * @param context Passed to `completion`.
+	 * @return `true` if the transfer was started, `false` otherwise.
+	 * @note Calibration commands mark the calibration registers unknown in the cache.
+	 */
+	bool commandAsync(
+		AsyncSPI		 &spi,
+		AsyncTransaction &transaction,
+		Command			  command,
+		AsyncCompletion	  completion = nullptr,
+		void			 *context	 = nullptr
+	) const noexcept;
+
+	/**
+	 * @brief Start reading conversion data without blocking.
 	 *
-	 * @return The current Status register value if successful, `std::nullopt` otherwise.
+	 * The frame is built into `transaction`, whose layout is fixed from the cached SYS register.
+	 * Once complete, decode it with `AsyncTransaction::conversion()`. Decoding one transaction
+	 * while another is in flight overlaps processing with the transfer.
 	 *
-	 * @note Calling this method updates the internal cached SYS register value, which is
-	 * referenced by rdata. If this behaviour is not desired, use rreg directly.
+	 * @param spi The asynchronous transport.
+	 * @param transaction Caller-owned frame storage. Must not be pending.
+	 * @param mode The conversion read method.
+	 * @param completion Called when the transfer finishes. May be `nullptr` to poll instead.
+	 * @param context Passed to `completion`.
+	 * @return `true` if the transfer was started, `false` otherwise.
+	 */
+	bool rdataAsync(
+		AsyncSPI		 &spi,
+		AsyncTransaction &transaction,
+		DataReadMode	  mode		 = DataReadMode::COMMAND,
+		AsyncCompletion	  completion = nullptr,
+		void			 *context	 = nullptr
+	) const noexcept;
+
+	/**
+	 * @brief Start a RREG operation without blocking.
+	 *
+	 * @param startAddress The starting register address to read from.
+	 * @param count The number of registers to read.
+	 * @return `true` if the transfer was started, `false` otherwise.
+	 * @note Once complete, call `completeAsync()` to update the register cache.
+	 */
+	bool rregAsync(
+		AsyncSPI		 &spi,
+		AsyncTransaction &transaction,
+		Address			  startAddress,
+		uint8_t			  count		 = 1u,
+		AsyncCompletion	  completion = nullptr,
+		void			 *context	 = nullptr
+	) const noexcept;
+
+	/**
+	 * @brief Start a WREG operation without blocking.
+	 *
+	 * @param startAddress The starting register address to write to.
+	 * @param count The number of registers to write.
+	 * @param buffer The register values. Copied into `transaction`, so it may be reused
+	 * immediately.
+	 * @return `true` if the transfer was started, `false` otherwise.
+	 * @note The written registers are marked unknown in the cache until `completeAsync()` is
+	 * called. Unlike `wreg()`, registers already cached are not trimmed.
+	 */
+	bool wregAsync(
+		AsyncSPI			 &spi,
+		AsyncTransaction	 &transaction,
+		Address				  startAddress,
+		uint8_t				  count,
+		const Register *const buffer,
+		AsyncCompletion		  completion = nullptr,
+		void				 *context	 = nullptr
+	) const noexcept;
+
+	/**
+	 * @brief Apply a finished RREG or WREG transaction to the register shadow cache.
+	 *
+	 * @param transaction A transaction started by `rregAsync()`, `wregAsync()` or
+	 * `commandAsync()`.
+	 * @return The first register value read or written, or the command sent, if the
+	 * transaction completed successfully, `std::nullopt` otherwise.
+	 * @note Call from the context owning the driver, not from the completion callback.
+	 * @note The cache and write statistics are updated once per transaction; calling again
+	 * only returns the result.
+	 */
+	std::optional<Register> completeAsync(const AsyncTransaction &transaction) const noexcept;
+
+	/**
+	 * @brief Get the System Control register and memorize it.
+	 *
+	 * @return The current SYS register value if successful, `std::nullopt` otherwise.
+	 *
+	 * @note Calling this method updates the cached SYS register value, which is referenced by
+	 * rdata.
 	 */
 	std::optional<SYS> getSystemControl(void) noexcept;
 
@@ -253,6 +758,7 @@ public:
 	 * @return The first register value read if successful, `std::nullopt` otherwise.
 	 * @warning If std::nullopt is returned, the ADC must either be reset, CS brought high, or
 	 * the ADC SPI timeout must elapse before the next command will be accepted.
+	 * @note The register shadow cache is updated with the values read.
 	 * @note Refer to the ADS124S08 §9.5.3.11 "RREG" for details.
 	 */
 	std::optional<Register> rreg(
@@ -272,6 +778,8 @@ public:
 	 * the ADC SPI timeout must elapse before the next command will be accepted.
 	 * @note Writing to certain registers may reset the digital filter and start a new
 	 * conversion.
+	 * @note Leading and trailing registers whose cached value already matches are trimmed from
+	 * the transaction. If every register matches, no SPI transaction is performed.
 	 * @note Refer to the ADS124S08 §9.5.3.12 "WREG" for details.
 	 */
 	std::optional<Register> wreg(
@@ -293,6 +801,8 @@ public:
 
 #include "Private/SPI_Register_I.hpp"
 
+#include "Private/RegisterDescriptor.hpp"
+
 #include "Private/ID.hpp"
 
 #include "Private/STATUS.hpp"
@@ -306,3 +816,40 @@ public:
 #include "Private/PGA.hpp"
 
 #include "Private/DATARATE.hpp"
+
+#include "Private/FixedPointScale.hpp"
+
+#include "Private/CRC8.hpp"
+
+#include "Private/LatencyModel.hpp"
+
+#include "Private/SampleQueue.hpp"
+
+#include "Private/Stream.hpp"
+
+#include "Private/ScanSequencer.hpp"
+
+#include "Private/AsyncSPI.hpp"
+
+#include "Private/DeviceManager.hpp"
+
+#include "Private/DataReady.hpp"
+
+#if defined(__linux__) && __has_include(<linux/spi/spidev.h>)
+#include "Private/SpidevSPI.hpp"
+#endif
+
+#include "Private/Simulator.hpp"
+
+#include "Private/InstrumentedSPI.hpp"
+
+#include "Private/Capture.hpp"
+
+#include "Private/Replay.hpp"
+
+#include "Private/BasicADS124S08.hpp"
+
+// The coroutine front-end is available to C++20 clients; the library itself builds as C++17
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include "Private/Coroutine.hpp"
+#endif
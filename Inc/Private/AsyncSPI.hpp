@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+
+/**
+ * @brief Asynchronous, completion-based SPI interface for the ADS124S08.
+ *
+ * Suited to DMA transports: a transfer is started and the call returns immediately, leaving the
+ * CPU free until the transport reports completion.
+ */
+class ADS124S08::AsyncSPI {
+public:
+	using Completion = AsyncCompletion;
+
+	/**
+	 * @brief Start a full-duplex transfer.
+	 *
+	 * @param txBuffer The bytes to clock out. Must remain valid until completion.
+	 * @param rxBuffer A buffer to store the bytes clocked in, or `nullptr` to discard them. Must
+	 * remain valid until completion.
+	 * @param count The number of bytes.
+	 * @param completion Called exactly once when the transfer finishes, if it was started.
+	 * @param context Passed to `completion`.
+	 * @return `true` if the transfer was started, `false` otherwise, e.g. if the bus is busy.
+	 */
+	virtual bool transfer(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count,
+		Completion			  completion,
+		void				 *context
+	) noexcept = 0;
+
+	virtual ~AsyncSPI() = default;
+};
+
+/**
+ * @brief Caller-owned storage for one asynchronous operation.
+ *
+ * Holds the transmit and receive frames for the duration of the transfer, so it must outlive
+ * the operation. Place it in memory reachable by the DMA controller. A transaction may be
+ * reused once it is no longer pending.
+ */
+struct ADS124S08::AsyncTransaction {
+	static constexpr uint8_t FRAME_SIZE = 2u + REGISTER_COUNT; // Largest RREG or WREG
+
+	enum class State : uint8_t {
+		IDLE,	   // Never started
+		PENDING,   // Transfer in progress
+		COMPLETED, // Transfer succeeded
+		FAILED,	   // Transfer failed or could not be started
+	};
+
+	alignas(4) std::array<Register, FRAME_SIZE> txFrame{};
+	alignas(4) std::array<Register, FRAME_SIZE> rxFrame{};
+
+	State state(void) const noexcept { return status.load(std::memory_order_acquire); }
+	bool  pending(void) const noexcept { return state() == State::PENDING; }
+
+	/**
+	 * @brief Decode the conversion of a completed `rdataAsync()`.
+	 *
+	 * @return The RDATA structure if the transaction read a conversion and completed
+	 * successfully, `std::nullopt` otherwise.
+	 */
+	std::optional<RDATA> conversion(void) const noexcept;
+
+	/**
+	 * @brief Get the registers of a completed `rregAsync()`.
+	 *
+	 * @return A pointer to the `count` register values read, or `nullptr` if the transaction
+	 * did not read registers or did not complete successfully.
+	 * @note Apply the values to the register cache with `ADS124S08::completeAsync()`.
+	 */
+	const Register *registers(void) const noexcept;
+
+private:
+	friend class ADS124S08;
+
+	enum class Operation : uint8_t { NONE, COMMAND, RREG, WREG, RDATA };
+
+	std::atomic<State> status{State::IDLE};
+	Operation		   operation{Operation::NONE};
+	Address			   address{Address::ID};
+	uint8_t			   count{0u};  // Registers in a RREG/WREG
+	uint8_t			   offset{0u}; // Bytes preceding the result in the receive frame
+	bool			   statusByte{false};
+	bool			   crcByte{false};
+	mutable bool	   applied{false}; // Applied to the register cache by completeAsync()
+	AsyncCompletion	   completion{nullptr};
+	void			  *context{nullptr};
+
+	bool start(AsyncSPI &spi, uint8_t length, AsyncCompletion completion, void *context) noexcept;
+
+	static void onTransferComplete(void *transaction, bool success) noexcept;
+};
@@ -0,0 +1,314 @@
+#pragma once
+
+#include <algorithm>
+
+/**
+ * @brief Adapt any type providing the `SPI` methods to the virtual `SPI` interface.
+ *
+ * @tparam TRANSPORT A type with `read()`, `write()` and `readWrite()` methods matching `SPI`. It
+ * need not derive from `SPI`.
+ */
+template <typename TRANSPORT> class ADS124S08::SPIAdapter final : public SPI {
+	TRANSPORT &transport;
+
+public:
+	explicit SPIAdapter(TRANSPORT &transport) noexcept : transport(transport) {}
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override {
+		return transport.read(buffer, count);
+	}
+
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept override {
+		return transport.write(buffer, count);
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>> readWrite(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count
+	) noexcept override {
+		return transport.readWrite(txBuffer, rxBuffer, count);
+	}
+};
+
+inline ADS124S08::RDATA ADS124S08::decodeConversion(
+	const Register *const frame,
+	const bool			  statusByte,
+	const bool			  crcByte
+) noexcept {
+	RDATA result;
+
+	uint8_t index = 0u;
+	if (statusByte) result.status = frame[index++];
+	else result.status = std::nullopt;
+
+	result.data = 0u;
+	for (uint8_t i = index; i < index + 3u; i++) {
+		result.data = (result.data << 8u) | frame[i];
+	}
+	index += 3u;
+
+	if (crcByte) result.crc = frame[index++];
+	else result.crc = std::nullopt;
+
+	return result;
+}
+
+template <typename TRANSPORT>
+std::optional<ADS124S08::Register>
+ADS124S08::sendCommand(TRANSPORT &transport, Command command) noexcept {
+	const auto writeResult = transport.write(&command, 1u);
+	if (writeResult) return command;
+	else return std::nullopt;
+}
+
+template <typename TRANSPORT>
+std::optional<ADS124S08::Register> ADS124S08::rregVia(
+	TRANSPORT		&transport,
+	const Address	 startAddress,
+	const uint8_t	 count,
+	Register *const	 buffer
+) const noexcept {
+	// Range checks
+	if (!validAddressRange(startAddress, count)) return std::nullopt;
+
+	// Nullptr check for single register read
+	if (buffer == nullptr) {
+		if (count != 1u) return std::nullopt;
+	}
+
+	// Single full-duplex frame: command bytes followed by NOPs while the registers shift out.
+	// Allocating excess to maintain STATIC stack usage
+	Register mosi[2 + REGISTER_COUNT] = {
+		(uint8_t)(0x20u | startAddress), // RREG command
+		(uint8_t)(count - 1u),			 // Number of registers to read minus one
+	};
+	Register miso[2 + REGISTER_COUNT];
+
+	const auto readWriteResult = transport.readWrite(mosi, miso, 2u + count);
+	if (!readWriteResult) return std::nullopt;
+
+	const Register *const registers = &miso[2];
+	if (buffer != nullptr) std::copy_n(registers, count, buffer);
+
+	updateCachedRange(startAddress, count, registers);
+	return registers[0];
+}
+
+template <typename TRANSPORT>
+std::optional<ADS124S08::Register> ADS124S08::wregVia(
+	TRANSPORT			 &transport,
+	const Address		  startAddress,
+	const uint8_t		  count,
+	const Register *const buffer
+) const noexcept {
+	// Range checks
+	if (!validAddressRange(startAddress, count)) return std::nullopt;
+	if (buffer == nullptr) return std::nullopt;
+
+	const auto [first, writeCount] = trimCachedWrite(startAddress, count, buffer);
+	if (writeCount == 0u) return buffer[0];
+
+	const Address writeAddress = static_cast<Address>(startAddress + first);
+
+	// Allocating excess to maintain STATIC stack usage
+	Register mosi[2 + REGISTER_COUNT];
+
+	mosi[0] = (uint8_t)(0x40u | writeAddress); // WREG command
+	mosi[1] = (uint8_t)(writeCount - 1u);	   // Number of registers to write minus one
+	std::copy_n(&buffer[first], writeCount, &mosi[2]);
+
+	const auto writeResult = transport.write(mosi, 2u + writeCount);
+
+	if (writeResult) {
+		writeStatistics.issuedWrites++;
+		updateCachedRange(writeAddress, writeCount, &mosi[2]);
+		return buffer[0];
+	} else {
+		// The device may have latched part of the transaction
+		invalidateCachedRange(writeAddress, writeCount);
+		return std::nullopt;
+	}
+}
+
+template <typename TRANSPORT>
+std::optional<ADS124S08::RDATA> ADS124S08::rdataVia(
+	TRANSPORT		   &transport,
+	DataReadMode		mode,
+	std::optional<bool> statusEnabled,
+	std::optional<bool> crcEnabled
+) const noexcept {
+	const SYS sys{registerCache[Address::SYS]};
+
+	// Default to the cached SYS value
+	const bool statusByte = statusEnabled.value_or(sys.sendStat());
+	const bool crcByte	  = crcEnabled.value_or(sys.crc());
+
+	const uint8_t offset	= (mode == DataReadMode::COMMAND) ? 1u : 0u; // RDATA byte
+	const uint8_t byteCount = 3u + (statusByte ? 1u : 0u) + (crcByte ? 1u : 0u);
+
+	// Single full-duplex frame. With the RDATA command, NOPs follow while the result shifts
+	// out; when reading directly only NOPs are clocked in.
+	// Max 6 bytes (RDATA + STATUS + 3 data + CRC)
+	Register mosiBuffer[6u] = {SPI::ControlCommand::NOP};
+	Register misoBuffer[6u] = {0};
+
+	if (mode == DataReadMode::COMMAND) mosiBuffer[0] = SPI::DataReadCommand::RDATA;
+
+	auto readWriteResult = transport.readWrite(mosiBuffer, misoBuffer, offset + byteCount);
+	if (!readWriteResult) return std::nullopt;
+
+	return decodeConversion(&misoBuffer[offset], statusByte, crcByte);
+}
+
+template <typename TRANSPORT>
+std::size_t ADS124S08::rdataBatchVia(
+	TRANSPORT		 &transport,
+	const RDATABatch &batch,
+	std::size_t		  count,
+	DataReadMode	  mode,
+	WaitReady		  waitReady,
+	void			 *context
+) const noexcept {
+	if (batch.data == nullptr) return 0u;
+
+	const SYS	  sys{registerCache[Address::SYS]};
+	const bool	  statusByte = sys.sendStat();
+	const bool	  crcByte	 = sys.crc();
+	const uint8_t offset	 = (mode == DataReadMode::COMMAND) ? 1u : 0u; // RDATA byte
+	const uint8_t dataIndex	 = offset + (statusByte ? 1u : 0u);
+	const uint8_t length	 = dataIndex + 3u + (crcByte ? 1u : 0u);
+
+	Register mosiBuffer[6u] = {SPI::ControlCommand::NOP};
+	Register misoBuffer[6u] = {0};
+
+	if (mode == DataReadMode::COMMAND) mosiBuffer[0] = SPI::DataReadCommand::RDATA;
+
+	for (std::size_t i = 0u; i < count; i++) {
+		if (waitReady != nullptr && !waitReady(context)) return i;
+		if (!transport.readWrite(mosiBuffer, misoBuffer, length)) return i;
+
+		batch.data[i] = (static_cast<uint32_t>(misoBuffer[dataIndex]) << 16u) |
+						(static_cast<uint32_t>(misoBuffer[dataIndex + 1u]) << 8u) |
+						(static_cast<uint32_t>(misoBuffer[dataIndex + 2u]));
+
+		if (statusByte && batch.status != nullptr) batch.status[i] = misoBuffer[offset];
+		if (crcByte && batch.crc != nullptr) batch.crc[i] = misoBuffer[dataIndex + 3u];
+	}
+
+	return count;
+}
+
+/**
+ * @brief Holds the `SPIAdapter` of a `BasicADS124S08`, so it is constructed before the
+ * `ADS124S08` base that refers to it.
+ */
+template <typename TRANSPORT> struct BasicADS124S08Adapter {
+	ADS124S08::SPIAdapter<TRANSPORT> adapter;
+};
+
+/**
+ * @brief ADS124S08 driver bound statically to a concrete transport.
+ *
+ * The commands, RREG/WREG and conversion reads call the transport directly, so a transport
+ * implemented inline, e.g. as a few peripheral register accesses, is inlined into `rdata()`
+ * with no virtual call per transfer. The register cache is shared with the `ADS124S08` base,
+ * which handles the remaining, infrequent operations through an `SPIAdapter`.
+ *
+ * @tparam TRANSPORT A type with `read()`, `write()` and `readWrite()` methods matching
+ * `ADS124S08::SPI`. Deriving from `ADS124S08::SPI` is optional; if it does, mark it `final`.
+ * @note These methods hide rather than override those of `ADS124S08`, which are not virtual.
+ * Through an `ADS124S08 &`, e.g. in `ScanSequencer`, `Stream` or `DeviceManager`, the driver
+ * takes the virtual `SPIAdapter` path, as the statically bound methods apply only when called
+ * on the `BasicADS124S08` itself.
+ */
+template <typename TRANSPORT>
+class BasicADS124S08 final : private BasicADS124S08Adapter<TRANSPORT>, public ADS124S08 {
+	TRANSPORT &transport;
+
+public:
+	/**
+	 * @brief Construct the driver and populate the register shadow cache.
+	 *
+	 * @param transport The transport connected to the ADS124S08. Must outlive the driver.
+	 */
+	explicit BasicADS124S08(TRANSPORT &transport)
+		: BasicADS124S08Adapter<TRANSPORT>{ADS124S08::SPIAdapter<TRANSPORT>{transport}},
+		  ADS124S08(this->adapter),
+		  transport(transport) {}
+
+	// The base refers to the adapter held by this object
+	BasicADS124S08(const BasicADS124S08 &)			  = delete;
+	BasicADS124S08 &operator=(const BasicADS124S08 &) = delete;
+
+	std::optional<Register> wakeup() noexcept {
+		return sendCommand(transport, SPI::ControlCommand::WAKEUP);
+	}
+
+	std::optional<Register> powerdown() noexcept {
+		return sendCommand(transport, SPI::ControlCommand::POWERDOWN);
+	}
+
+	std::optional<Register> start() noexcept {
+		return sendCommand(transport, SPI::ControlCommand::START);
+	}
+
+	std::optional<Register> stop() noexcept {
+		return sendCommand(transport, SPI::ControlCommand::STOP);
+	}
+
+	std::optional<RDATA> rdata(
+		std::optional<bool> statusEnabled = std::nullopt,
+		std::optional<bool> crcEnabled	  = std::nullopt
+	) const noexcept {
+		return rdataVia(transport, DataReadMode::COMMAND, statusEnabled, crcEnabled);
+	}
+
+	std::optional<RDATA> rdataDirect(
+		std::optional<bool> statusEnabled = std::nullopt,
+		std::optional<bool> crcEnabled	  = std::nullopt
+	) const noexcept {
+		return rdataVia(transport, DataReadMode::DIRECT, statusEnabled, crcEnabled);
+	}
+
+	std::optional<RDATA> rdata(DataReadMode mode) const noexcept {
+		return rdataVia(transport, mode, std::nullopt, std::nullopt);
+	}
+
+	std::size_t rdataBatch(
+		const RDATABatch &batch,
+		std::size_t		  count,
+		DataReadMode	  mode		= DataReadMode::COMMAND,
+		WaitReady		  waitReady = nullptr,
+		void			 *context	= nullptr
+	) const noexcept {
+		return rdataBatchVia(transport, batch, count, mode, waitReady, context);
+	}
+
+	std::optional<Register> rreg(
+		Address			startAddress, //
+		uint8_t			count  = 1,
+		Register *const buffer = nullptr
+	) const noexcept {
+		return rregVia(transport, startAddress, count, buffer);
+	}
+
+	std::optional<Register> wreg(
+		Address				  startAddress, //
+		uint8_t				  count,
+		const Register *const buffer
+	) const noexcept {
+		return wregVia(transport, startAddress, count, buffer);
+	}
+
+	std::optional<Register> wreg(Address startAddress, const Register &value) const noexcept {
+		return wregVia(transport, startAddress, 1u, &value);
+	}
+
+	template <typename REGISTER, typename = typename REGISTER::Descriptor>
+	std::optional<Register> setRegister(const REGISTER &reg) const noexcept {
+		return wreg(REGISTER::Descriptor::address, reg.REGISTER::toRegister());
+	}
+
+	using ADS124S08::setRegister;
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+/**
+ * @brief CRC-8 used to protect conversion data frames.
+ *
+ * Polynomial x^8 + x^2 + x + 1 (CRC-8-ATM), MSB first, preset to FFh, no final XOR.
+ *
+ * @note Refer to the ADS124S08 §9.5.4.3 "CRC" for details.
+ */
+struct ADS124S08::CRC8 {
+	static constexpr Register POLYNOMIAL	= 0x07u;
+	static constexpr Register INITIAL_VALUE = 0xFFu;
+
+	enum class Backend : uint8_t {
+		BITWISE,	  // No tables, 8 iterations per byte
+		TABLE,		  // 256-byte table, one lookup per byte
+		SLICING_BY_4, // 1 KiB of tables, 4 bytes per step
+	};
+
+	/**
+	 * @brief Compute the CRC over a buffer.
+	 *
+	 * @param data The bytes to compute over.
+	 * @param length The number of bytes.
+	 * @param backend The implementation to use.
+	 * @param initial The CRC preset value.
+	 * @return The CRC.
+	 */
+	static Register compute(
+		const Register *const data,
+		std::size_t			  length,
+		Backend				  backend = Backend::TABLE,
+		Register			  initial = INITIAL_VALUE
+	) noexcept;
+
+	static Register bitwise(
+		const Register *const data,
+		std::size_t			  length,
+		Register			  initial = INITIAL_VALUE
+	) noexcept;
+
+	static Register table(
+		const Register *const data,
+		std::size_t			  length,
+		Register			  initial = INITIAL_VALUE
+	) noexcept;
+
+	static Register slicing(
+		const Register *const data,
+		std::size_t			  length,
+		Register			  initial = INITIAL_VALUE
+	) noexcept;
+
+	/**
+	 * @brief Verify an array of captured frames, each ending in its CRC byte.
+	 *
+	 * @param frames `count` contiguous frames of `frameLength` bytes, e.g. STATUS, 3 data bytes,
+	 * CRC.
+	 * @param frameLength The bytes per frame, including the trailing CRC byte. At least 2.
+	 * @param count The number of frames.
+	 * @param results Optional array of `count` per-frame results. May be `nullptr`.
+	 * @param backend The implementation to use.
+	 * @return The number of frames failing verification.
+	 */
+	static std::size_t verifyFrames(
+		const Register *const frames,
+		std::size_t			  frameLength,
+		std::size_t			  count,
+		bool *const			  results = nullptr,
+		Backend				  backend = Backend::SLICING_BY_4
+	) noexcept;
+
+	/**
+	 * @brief Verify conversions captured with `rdataBatch()`.
+	 *
+	 * @param batch The captured arrays. `crc` must not be `nullptr`; `status` must not be
+	 * `nullptr` if the STATUS byte was enabled.
+	 * @param count The number of conversions.
+	 * @param statusEnabled Whether the STATUS byte was enabled, and so covered by the CRC.
+	 * @param results Optional array of `count` per-conversion results. May be `nullptr`.
+	 * @param backend The implementation to use.
+	 * @return The number of conversions failing verification, or `count` if the batch is
+	 * missing a required array.
+	 */
+	static std::size_t verifyBatch(
+		const RDATABatch &batch,
+		std::size_t		  count,
+		bool			  statusEnabled,
+		bool *const		  results = nullptr,
+		Backend			  backend = Backend::SLICING_BY_4
+	) noexcept;
+};
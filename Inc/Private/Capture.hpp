@@ -0,0 +1,319 @@
+#pragma once
+
+#include <cstdio>
+#include <iterator>
+
+/**
+ * @brief Header of a binary capture: the acquisition configuration the records were taken with.
+ *
+ * A capture file is a fixed `SIZE`-byte header followed by one record per conversion. A record
+ * is the RDATA frame exactly as clocked out of the device: [STATUS] DATA[23:16] DATA[15:8]
+ * DATA[7:0] [CRC], where STATUS and CRC are present when enabled in the header. Multi-byte
+ * header fields are little-endian. A truncated trailing record, e.g. after a crash, is ignored.
+ *
+ * Header layout:
+ * | Offset | Size | Field                                                  |
+ * |--------|------|--------------------------------------------------------|
+ * | 0      | 8    | `MAGIC`                                                |
+ * | 8      | 2    | `VERSION`                                              |
+ * | 10     | 2    | Header size, `SIZE`                                    |
+ * | 12     | 1    | Flags: bit 0 STATUS byte, bit 1 CRC byte               |
+ * | 13     | 1    | Record size, 3 to 5                                    |
+ * | 14     | 1    | Register count, `REGISTER_COUNT`                       |
+ * | 15     | 1    | Reserved, 0                                            |
+ * | 16     | 4    | ADS124S08 clock frequency in Hz                        |
+ * | 20     | 4    | Register validity, bit n set when register n is known |
+ * | 24     | 8    | Start time in nanoseconds                              |
+ * | 32     | 18   | Register file, ID to GPIOCON, 0 where not known        |
+ * | 50     | 14   | Reserved, 0                                            |
+ */
+struct ADS124S08::CaptureHeader {
+	static constexpr std::size_t				 SIZE	 = 64u;
+	static constexpr std::array<Register, 8u>	 MAGIC	 = {'A', 'D', 'S', '1', '2', '4', 'C', 'P'};
+	static constexpr uint16_t					 VERSION = 1u;
+
+	std::array<Register, REGISTER_COUNT> registers{};
+	bool								 statusByte{false};
+	bool								 crcByte{false};
+	uint32_t							 clockHz{LatencyModel::INTERNAL_CLOCK_HZ};
+	uint64_t							 startNanoseconds{0u};
+	uint32_t							 registersValid{0u};
+
+	/**
+	 * @brief Describe an acquisition from the register shadow cache of a driver.
+	 *
+	 * The record layout follows the SENDSTAT and CRC_EN bits of the cached SYS register.
+	 *
+	 * @note Only registers the cache knows to match the device are snapshotted and flagged in
+	 * `registersValid`: ID, STATUS and GPIODAT never are, nor the calibration registers after a
+	 * calibration until they are read back.
+	 */
+	static CaptureHeader fromDriver(
+		const ADS124S08 &adc,
+		uint64_t		 startNanoseconds = 0u,
+		uint32_t		 clockHz		  = LatencyModel::INTERNAL_CLOCK_HZ
+	) noexcept;
+
+	uint8_t recordSize(void) const noexcept {
+		return static_cast<uint8_t>(3u + (statusByte ? 1u : 0u) + (crcByte ? 1u : 0u));
+	}
+
+	void serialize(Register *const buffer) const noexcept;
+
+	/**
+	 * @brief Parse a serialized header.
+	 *
+	 * @return The header if `size` bytes hold a valid one, `std::nullopt` otherwise.
+	 */
+	static std::optional<CaptureHeader> parse(const Register *const buffer, std::size_t size)
+		noexcept;
+};
+
+/**
+ * @brief Streaming writer of binary captures.
+ *
+ * Records are packed into an internal buffer and handed to the sink whenever it fills, so the
+ * acquisition path only copies a few bytes per conversion. `record()` matches
+ * `ADS124S08::ConversionHandler`, so a writer can be fed straight from `acquire()`:
+ *
+ * @code
+ * ADS124S08::CaptureWriter writer{ADS124S08::CaptureWriter::writeFile, file};
+ * writer.begin(ADS124S08::CaptureHeader::fromDriver(adc));
+ * adc.acquire(drdy, count, ADS124S08::CaptureWriter::record, &writer);
+ * writer.flush();
+ * @endcode
+ *
+ * A capture of 4 kSPS 24-bit data with STATUS and CRC takes 20 kB/s.
+ */
+class ADS124S08::CaptureWriter {
+public:
+	static constexpr std::size_t BUFFER_SIZE = 4096u;
+
+	/**
+	 * @brief Destination of the capture bytes.
+	 *
+	 * @param context The user context given to the constructor.
+	 * @return `true` if all `count` bytes were written, `false` otherwise.
+	 */
+	using Sink = bool (*)(void *context, const Register *data, std::size_t count) noexcept;
+
+	/**
+	 * @brief Sink writing to a `std::FILE *` given as the context.
+	 */
+	static bool writeFile(void *file, const Register *data, std::size_t count) noexcept;
+
+	CaptureWriter(Sink sink, void *context) noexcept : sink(sink), context(context) {}
+
+	CaptureWriter(const CaptureWriter &)			= delete;
+	CaptureWriter &operator=(const CaptureWriter &) = delete;
+
+	/**
+	 * @brief Write the header, fixing the record layout for the following conversions.
+	 *
+	 * @return `true` if the header was buffered, `false` if the writer had failed.
+	 */
+	bool begin(const CaptureHeader &header) noexcept;
+
+	/**
+	 * @brief Append a conversion.
+	 *
+	 * A STATUS or CRC byte required by the header but absent from `data` is written as 0x00.
+	 *
+	 * @return `false` if the writer was not begun or the sink failed, `true` otherwise.
+	 */
+	bool append(const RDATA &data) noexcept;
+
+	/**
+	 * @brief Append the conversions of an `rdataBatch()`.
+	 *
+	 * @return The number of conversions appended.
+	 */
+	std::size_t append(const RDATABatch &batch, std::size_t count) noexcept;
+
+	/**
+	 * @brief Hand the buffered bytes to the sink.
+	 *
+	 * @return `true` if every byte written so far reached the sink.
+	 */
+	bool flush(void) noexcept;
+
+	/**
+	 * @brief `ConversionHandler` appending each conversion to the writer given as the context.
+	 *
+	 * @return `false` to stop the acquisition once the sink fails.
+	 */
+	static bool record(void *writer, const RDATA &data) noexcept;
+
+	uint64_t recordCount(void) const noexcept { return records; }
+	bool	 failed(void) const noexcept { return failure; }
+
+private:
+	const Sink	sink;
+	void *const context;
+
+	std::array<Register, BUFFER_SIZE> buffer{};
+	std::size_t						  used{0u};
+
+	bool	 begun{false};
+	bool	 failure{false};
+	bool	 statusByte{false};
+	bool	 crcByte{false};
+	uint64_t records{0u};
+
+	bool reserve(std::size_t count) noexcept;
+	void pack(std::optional<Register> status, uint32_t data, std::optional<Register> crc) noexcept;
+};
+
+/**
+ * @brief Read-only, zero-copy view over a capture held in memory.
+ *
+ * Samples are decoded on access from the underlying bytes, which must outlive the view. Without
+ * STATUS and CRC the records are packed 3-byte frames, which `RDATA::framesToVoltages()`
+ * converts in bulk from `records()`.
+ */
+class ADS124S08::CaptureView {
+public:
+	/**
+	 * @brief One record of the capture.
+	 */
+	class Sample {
+	public:
+		std::optional<Register> status(void) const noexcept {
+			return statusByte ? std::optional<Register>{frame[0]} : std::nullopt;
+		}
+
+		/**
+		 * @brief Get the raw 24-bit two's complement code, as in `RDATA::data`.
+		 */
+		uint32_t data(void) const noexcept {
+			const Register *const bytes = &frame[statusByte ? 1u : 0u];
+			return (uint32_t{bytes[0]} << 16u) | (uint32_t{bytes[1]} << 8u) | bytes[2];
+		}
+
+		/**
+		 * @brief Get the sign-extended code.
+		 */
+		int32_t code(void) const noexcept {
+			const uint32_t raw = data();
+			return static_cast<int32_t>(raw ^ 0x800000u) - 0x800000;
+		}
+
+		std::optional<Register> crc(void) const noexcept {
+			return crcByte ? std::optional<Register>{frame[statusByte ? 4u : 3u]} : std::nullopt;
+		}
+
+		RDATA toRDATA(void) const noexcept {
+			return decodeConversion(frame, statusByte, crcByte);
+		}
+
+		const Register *bytes(void) const noexcept { return frame; }
+
+	private:
+		friend class CaptureView;
+
+		const Register *frame;
+		bool			statusByte;
+		bool			crcByte;
+
+		Sample(const Register *frame, bool statusByte, bool crcByte) noexcept
+			: frame(frame), statusByte(statusByte), crcByte(crcByte) {}
+	};
+
+	class Iterator {
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type		= Sample;
+		using difference_type	= std::ptrdiff_t;
+		using pointer			= void;
+		using reference			= Sample;
+
+		Sample operator*(void) const noexcept { return (*view)[index]; }
+
+		Iterator &operator++(void) noexcept {
+			index++;
+			return *this;
+		}
+
+		Iterator &operator+=(difference_type n) noexcept {
+			index += n;
+			return *this;
+		}
+
+		difference_type operator-(const Iterator &other) const noexcept {
+			return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+		}
+
+		bool operator==(const Iterator &other) const noexcept { return index == other.index; }
+		bool operator!=(const Iterator &other) const noexcept { return index != other.index; }
+
+	private:
+		friend class CaptureView;
+
+		const CaptureView *view;
+		std::size_t		   index;
+
+		Iterator(const CaptureView *view, std::size_t index) noexcept : view(view), index(index) {}
+	};
+
+	/**
+	 * @brief View a capture.
+	 *
+	 * @param data The capture bytes, header included.
+	 * @param size The number of bytes.
+	 * @return The view if the header is valid, `std::nullopt` otherwise.
+	 */
+	static std::optional<CaptureView> parse(const Register *const data, std::size_t size) noexcept;
+
+	const CaptureHeader &header(void) const noexcept { return captureHeader; }
+
+	std::size_t size(void) const noexcept { return count; }
+
+	Sample operator[](std::size_t index) const noexcept {
+		return Sample{&first[index * stride], captureHeader.statusByte, captureHeader.crcByte};
+	}
+
+	/**
+	 * @brief Get the packed records, `header().recordSize()` bytes each.
+	 */
+	const Register *records(void) const noexcept { return first; }
+
+	Iterator begin(void) const noexcept { return Iterator{this, 0u}; }
+	Iterator end(void) const noexcept { return Iterator{this, count}; }
+
+private:
+	CaptureHeader	captureHeader;
+	const Register *first;
+	std::size_t		count;
+	uint8_t			stride;
+
+	CaptureView(const CaptureHeader &header, const Register *first, std::size_t count) noexcept
+		: captureHeader(header), first(first), count(count), stride(header.recordSize()) {}
+};
+
+#if __has_include(<sys/mman.h>)
+/**
+ * @brief Capture file mapped into memory, so that hours of data reload without being parsed.
+ */
+class ADS124S08::CaptureFile {
+public:
+	CaptureFile(void) noexcept = default;
+	~CaptureFile() { close(); }
+
+	CaptureFile(const CaptureFile &)			= delete;
+	CaptureFile &operator=(const CaptureFile &) = delete;
+
+	/**
+	 * @brief Map a capture file, closing any file mapped before.
+	 *
+	 * @return The view over the file if it was mapped and holds a valid capture, `std::nullopt`
+	 * otherwise. The view is valid until `close()`.
+	 */
+	std::optional<CaptureView> open(const char *path) noexcept;
+
+	void close(void) noexcept;
+
+private:
+	const Register *mapping{nullptr};
+	std::size_t		length{0u};
+};
+#endif
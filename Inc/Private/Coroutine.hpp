@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Coroutine type for acquisition sequences written against
+ * `ADS124S08::AwaitableADS124S08`.
+ *
+ * A task starts suspended. Awaiting it from another task runs it to completion before the
+ * awaiting task resumes; a top-level task is started with `resume()` and then advances each
+ * time one of its transfers completes or a DRDY edge is notified.
+ *
+ * @tparam T The value returned with `co_return`, or `void`.
+ * @note Exceptions are not supported; a task that throws terminates the program.
+ */
+template <typename T> class ADS124S08::Task {
+	// Resumes the awaiting task, if any, once this one has finished
+	struct FinalAwaiter {
+		bool await_ready(void) const noexcept { return false; }
+		void await_resume(void) const noexcept {}
+
+		template <typename PROMISE>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<PROMISE> handle
+		) const noexcept {
+			return handle.promise().continuation;
+		}
+	};
+
+	struct PromiseBase {
+		std::coroutine_handle<> continuation{std::noop_coroutine()};
+
+		std::suspend_always initial_suspend(void) const noexcept { return {}; }
+		FinalAwaiter		final_suspend(void) const noexcept { return {}; }
+
+		void unhandled_exception(void) const noexcept { std::terminate(); }
+	};
+
+	struct ValuePromise : PromiseBase {
+		std::optional<T> value{};
+
+		void return_value(T result) noexcept { value.emplace(std::move(result)); }
+	};
+
+	struct VoidPromise : PromiseBase {
+		void return_void(void) const noexcept {}
+	};
+
+public:
+	struct promise_type : std::conditional_t<std::is_void_v<T>, VoidPromise, ValuePromise> {
+		Task get_return_object(void) noexcept {
+			return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+		}
+	};
+
+	Task(Task &&other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+	Task(const Task &)			  = delete;
+	Task &operator=(const Task &) = delete;
+	Task &operator=(Task &&)	  = delete;
+
+	~Task() {
+		if (handle) handle.destroy();
+	}
+
+	/**
+	 * @brief Start a top-level task, running it until its first suspension.
+	 */
+	void resume(void) const noexcept {
+		if (!handle.done()) handle.resume();
+	}
+
+	bool done(void) const noexcept { return handle.done(); }
+
+	/**
+	 * @brief Get the value returned by a finished task.
+	 */
+	template <typename U = T, typename = std::enable_if_t<!std::is_void_v<U>>>
+	U &result(void) const noexcept {
+		return *handle.promise().value;
+	}
+
+	bool await_ready(void) const noexcept { return false; }
+
+	std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept {
+		handle.promise().continuation = awaiting;
+		return handle;
+	}
+
+	T await_resume(void) const noexcept {
+		if constexpr (!std::is_void_v<T>) return std::move(*handle.promise().value);
+	}
+
+private:
+	std::coroutine_handle<promise_type> handle;
+
+	explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+};
+
+/**
+ * @brief Awaitable front-end of an `ADS124S08` on an asynchronous transport.
+ *
+ * Each operation suspends the calling `ADS124S08::Task` until its transfer completes, so
+ * sequences such as calibrate, configure and scan are written linearly while any number of
+ * devices progress cooperatively on one thread:
+ *
+ * @code
+ * ADS124S08::Task<void> acquire(ADS124S08::AwaitableADS124S08 &adc) {
+ *     co_await adc.selfOffsetCalibrate();
+ *     co_await adc.setRegister(ADS124S08::INPMUX{...});
+ *     while (true) {
+ *         co_await adc.waitDrdy();
+ *         const auto sample = co_await adc.rdata();
+ *     }
+ * }
+ * @endcode
+ *
+ * The register shadow cache of the wrapped driver is updated as each operation completes.
+ *
+ * @note A task resumes in the context that calls the transfer completion or `notifyDrdy()`.
+ * For a single-threaded event loop, deliver both from the loop rather than from interrupts.
+ * @note Operations of one device are sequential: one transaction is held per device.
+ */
+class ADS124S08::AwaitableADS124S08 {
+public:
+	/**
+	 * @brief Construct the front-end.
+	 *
+	 * @param adc The driver whose register cache and SYS configuration are used.
+	 * @param spi The asynchronous transport connected to the same device.
+	 */
+	AwaitableADS124S08(ADS124S08 &adc, ADS124S08::AsyncSPI &spi) noexcept : adc(adc), spi(spi) {}
+
+	AwaitableADS124S08(const AwaitableADS124S08 &)			  = delete;
+	AwaitableADS124S08 &operator=(const AwaitableADS124S08 &) = delete;
+
+	/**
+	 * @brief Send a command.
+	 *
+	 * @return Awaitable for the command sent if successful, `std::nullopt` otherwise.
+	 */
+	auto command(Command command) noexcept {
+		return transfer(
+			[command](AwaitableADS124S08 &self, void *context) {
+				return self.adc.commandAsync(self.spi, self.transaction, command, resume, context);
+			},
+			&AwaitableADS124S08::completeRegister
+		);
+	}
+
+	auto start(void) noexcept { return command(ADS124S08::SPI::ControlCommand::START); }
+	auto stop(void) noexcept { return command(ADS124S08::SPI::ControlCommand::STOP); }
+
+	/**
+	 * @brief Read the conversion data.
+	 *
+	 * @return Awaitable for the RDATA structure if successful, `std::nullopt` otherwise.
+	 */
+	auto rdata(DataReadMode mode = DataReadMode::COMMAND) noexcept {
+		return transfer(
+			[mode](AwaitableADS124S08 &self, void *context) {
+				return self.adc.rdataAsync(self.spi, self.transaction, mode, resume, context);
+			},
+			[](AwaitableADS124S08 &self) { return self.transaction.conversion(); }
+		);
+	}
+
+	/**
+	 * @brief Read registers, updating the register cache.
+	 *
+	 * @param buffer Receives the `count` values read if not `nullptr`. Must remain valid until
+	 * the operation completes.
+	 * @return Awaitable for the first register value read if successful, `std::nullopt`
+	 * otherwise.
+	 */
+	auto rreg(Address startAddress, uint8_t count = 1u, Register *const buffer = nullptr) noexcept {
+		return transfer(
+			[startAddress, count](AwaitableADS124S08 &self, void *context) {
+				return self.adc.rregAsync(
+					self.spi, self.transaction, startAddress, count, resume, context
+				);
+			},
+			[count, buffer](AwaitableADS124S08 &self) {
+				const auto result = self.completeRegister();
+				if (result && buffer != nullptr) {
+					std::copy_n(self.transaction.registers(), count, buffer);
+				}
+				return result;
+			}
+		);
+	}
+
+	/**
+	 * @brief Write registers, updating the register cache.
+	 *
+	 * @return Task for the first register value written if successful, `std::nullopt`
+	 * otherwise.
+	 * @note As with `ADS124S08::wreg()`, registers the cache shows the device already holds are
+	 * trimmed from both ends of the range, and nothing is sent if none are left.
+	 */
+	ADS124S08::Task<std::optional<Register>>
+	wreg(Address startAddress, uint8_t count, const Register *const buffer) noexcept {
+		if (!validAddressRange(startAddress, count) || buffer == nullptr) co_return std::nullopt;
+
+		const auto [first, writeCount] = adc.trimCachedWrite(startAddress, count, buffer);
+		if (writeCount == 0u) co_return buffer[0];
+
+		const auto address = static_cast<Address>(startAddress + first);
+		const auto start   = [address, size = writeCount, data = &buffer[first]](
+			AwaitableADS124S08 &self, void *context
+		) {
+			return self.adc.wregAsync(
+				self.spi, self.transaction, address, size, data, resume, context
+			);
+		};
+		const auto result = co_await transfer(start, &AwaitableADS124S08::completeRegister);
+		if (!result) co_return std::nullopt;
+		co_return buffer[0];
+	}
+
+	template <typename REGISTER, typename = typename REGISTER::Descriptor>
+	auto setRegister(const REGISTER &reg) noexcept {
+		registerValue = reg.REGISTER::toRegister();
+		return wreg(REGISTER::Descriptor::address, 1u, &registerValue);
+	}
+
+	/**
+	 * @brief Wait for the next DRDY falling edge reported with `notifyDrdy()`.
+	 *
+	 * Completes immediately if an edge was notified since the last wait.
+	 */
+	auto waitDrdy(void) noexcept {
+		struct DrdyAwaiter {
+			AwaitableADS124S08 &self;
+
+			bool await_ready(void) const noexcept { return std::exchange(self.drdyPending, false); }
+			void await_suspend(std::coroutine_handle<> handle) const noexcept {
+				self.drdyWaiter = handle;
+			}
+			void await_resume(void) const noexcept {}
+		};
+		return DrdyAwaiter{*this};
+	}
+
+	/**
+	 * @brief Report a DRDY falling edge, resuming the task waiting for it.
+	 */
+	void notifyDrdy(void) noexcept {
+		if (drdyWaiter) std::exchange(drdyWaiter, nullptr).resume();
+		else drdyPending = true;
+	}
+
+	/**
+	 * @brief Perform self offset calibration and wait for it to finish.
+	 *
+	 * @return The command sent if successful, `std::nullopt` otherwise.
+	 * @note Calibration ends with DRDY, so edges must be reported with `notifyDrdy()`.
+	 * Conversions must be started.
+	 */
+	ADS124S08::Task<std::optional<Register>> selfOffsetCalibrate(void) noexcept {
+		drdyPending = false; // Only an edge after the command marks the end of calibration
+
+		const auto result = co_await command(ADS124S08::SPI::CalibrationCommand::SELF_OFFSET_CAL);
+		if (result) co_await waitDrdy();
+		co_return result;
+	}
+
+private:
+	ADS124S08			&adc;
+	ADS124S08::AsyncSPI &spi;
+
+	ADS124S08::AsyncTransaction transaction{};
+	Register					registerValue{0u}; // Staged by setRegister()
+
+	std::coroutine_handle<> drdyWaiter{nullptr};
+	bool					drdyPending{false};
+
+	// Progress of the transfer in flight, telling a completion within transfer() from a later one
+	enum class TransferPhase : uint8_t { STARTING, SUSPENDED, COMPLETED };
+
+	std::coroutine_handle<>	   transferWaiter{nullptr};
+	std::atomic<TransferPhase> transferPhase{TransferPhase::COMPLETED};
+
+	static void resume(void *context, bool) noexcept {
+		auto &self = *static_cast<AwaitableADS124S08 *>(context);
+		// A completion within transfer() is left to await_suspend() rather than resumed here,
+		// which would nest a frame per transfer on transports that complete synchronously
+		if (self.transferPhase.exchange(TransferPhase::COMPLETED) == TransferPhase::SUSPENDED) {
+			self.transferWaiter.resume();
+		}
+	}
+
+	std::optional<Register> completeRegister(void) noexcept {
+		return adc.completeAsync(transaction);
+	}
+
+	/**
+	 * @brief Awaiter starting a transfer on suspension and decoding it on resumption.
+	 */
+	template <typename START, typename FINISH> struct TransferAwaiter {
+		using Result = std::invoke_result_t<FINISH, AwaitableADS124S08 &>;
+
+		AwaitableADS124S08 &self;
+		START				start;
+		FINISH				finish;
+		bool				failed{false};
+
+		bool await_ready(void) const noexcept { return false; }
+
+		bool await_suspend(std::coroutine_handle<> handle) noexcept {
+			self.transferWaiter = handle;
+			self.transferPhase.store(TransferPhase::STARTING);
+
+			// Once started, the completion may resume the task and destroy this awaiter before
+			// the call returns, so it is only touched when the transfer was not started
+			if (!start(self, &self)) {
+				failed = true;
+				return false;
+			}
+
+			// Continue without suspending if the transfer already completed
+			return self.transferPhase.exchange(TransferPhase::SUSPENDED)
+				!= TransferPhase::COMPLETED;
+		}
+
+		Result await_resume(void) noexcept {
+			if (failed) return Result{};
+			return std::invoke(finish, self);
+		}
+	};
+
+	template <typename START, typename FINISH>
+	TransferAwaiter<START, FINISH> transfer(START start, FINISH finish) noexcept {
+		return {*this, start, finish};
+	}
+};
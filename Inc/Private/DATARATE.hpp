@@ -2,55 +2,81 @@
 
 using Register = ADS124S08::SPI::Register;
 
-struct ADS124S08::DATARATE : public SPI_Register_I {
+struct ADS124S08::DATARATE final : public SPI_Register_I {
 private:
-	static const Address  ADDRESS{0x04u};
-	static const Register RESET_VALUE{0x14u};
+	using G_CHOP = RegisterField<7u, 1u>;
+	using CLK	 = RegisterField<6u, 1u>;
+	using MODE	 = RegisterField<5u, 1u>;
+	using FILTER = RegisterField<4u, 1u>;
+	using DR	 = RegisterField<0u, 4u>;
 
-	Register G_CHOP : 1;
-	Register CLK	: 1;
-	Register MODE	: 1;
-	Register FILTER : 1;
-	Register DR		: 4;
+public:
+	using Descriptor = RegisterDescriptor<Address::DATA_RATE, 0x14u, G_CHOP, CLK, MODE, FILTER, DR>;
+
+private:
+	static constexpr Address  ADDRESS	  = Descriptor::address;
+	static constexpr Register RESET_VALUE = Descriptor::resetValue;
+
+	Register reg;
 
 public:
-	DATARATE(Register val = RESET_VALUE);
+	constexpr DATARATE(Register val = RESET_VALUE) : reg(val) {}
 
 	enum class ChopperEnable : Register {
 		DISABLED = 0b0u, // (default) Chopper Disabled
 		ENABLED	 = 0b1u, // Chopper Enabled
 	};
 
-	DATARATE &setGlobalChop(ChopperEnable enable);
+	constexpr DATARATE &setGlobalChop(ChopperEnable enable) {
+		reg = G_CHOP::insert(reg, static_cast<Register>(enable));
+		return *this;
+	}
 
-	ChopperEnable getGlobalChop(void) const;
+	constexpr ChopperEnable getGlobalChop(void) const {
+		return static_cast<ChopperEnable>(G_CHOP::unpack(reg));
+	}
 
 	enum class ClockSelect : Register {
 		INTERNAL = 0b0u, // (default) Internal Clock
 		EXTERNAL = 0b1u, // External Clock
 	};
 
-	DATARATE &setClockSelect(ClockSelect clk);
+	constexpr DATARATE &setClockSelect(ClockSelect clk) {
+		reg = CLK::insert(reg, static_cast<Register>(clk));
+		return *this;
+	}
 
-	ClockSelect getClockSelect(void) const;
+	constexpr ClockSelect getClockSelect(void) const {
+		return static_cast<ClockSelect>(CLK::unpack(reg));
+	}
 
 	enum class ModeSelect : Register {
 		CONTINUOUS	= 0b0u,
 		SINGLE_SHOT = 0b1u,
 	};
 
-	DATARATE &setConversionMode(ModeSelect mode);
+	constexpr DATARATE &setConversionMode(ModeSelect mode) {
+		reg = MODE::insert(reg, static_cast<Register>(mode));
+		return *this;
+	}
 
-	ModeSelect getConversionMode(void) const;
+	constexpr ModeSelect getConversionMode(void) const {
+		return static_cast<ModeSelect>(MODE::unpack(reg));
+	}
 
 	enum class FilterSelect : Register {
 		SINC3		= 0b0u, // (default) SINC3 Filter
 		LOW_LATENCY = 0b1u, // SINC4 Filter with 2x Oversampling
 	};
 
-	DATARATE &setFilter(FilterSelect filter);
+	constexpr DATARATE &setFilter(FilterSelect filter) {
+		reg = FILTER::insert(reg, static_cast<Register>(filter));
+		return *this;
+	}
 
-	FilterSelect getFilter(void) const;
+	constexpr FilterSelect getFilter(void) const {
+		return static_cast<FilterSelect>(FILTER::unpack(reg));
+	}
 
 	enum class DataRate : Register {
 		RATE_2_5  = 0b0000u,
@@ -71,11 +97,19 @@ public:
 		// 0b1111u is reserved
 	};
 
-	DATARATE &setDataRate(DataRate rate);
+	constexpr DATARATE &setDataRate(DataRate rate) {
+		reg = DR::insert(reg, static_cast<Register>(rate));
+		return *this;
+	}
+
+	constexpr DataRate getDataRate(void) const { return static_cast<DataRate>(DR::unpack(reg)); }
 
-	DATARATE::DataRate getDataRate(void) const;
+	/**
+	 * @brief Get the packed register value. Usable in constant expressions.
+	 */
+	constexpr Register value(void) const noexcept { return reg; }
 
-	virtual Register toRegister(void) const override;
+	virtual Register toRegister(void) const override { return value(); }
 	virtual Address	 getAddress(void) const override { return ADDRESS; }
 	virtual Register getResetValue(void) const override { return RESET_VALUE; }
 };
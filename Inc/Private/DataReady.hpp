@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Data-ready (DRDY) interface of an ADS124S08.
+ *
+ * Implement `wait()` on top of the platform's GPIO edge events, e.g. with a semaphore given
+ * from the DRDY interrupt, or use `EdgeDataReady` or `StatusDataReady`.
+ */
+class ADS124S08::DataReady {
+public:
+	static constexpr uint32_t WAIT_FOREVER = UINT32_MAX;
+
+	/**
+	 * @brief Sleep hook used by the polling implementations.
+	 *
+	 * @param context The user context given to the constructor.
+	 * @param microseconds The time to sleep.
+	 */
+	using Sleep = void (*)(void *context, uint32_t microseconds) noexcept;
+
+	/**
+	 * @brief Block until the next DRDY falling edge.
+	 *
+	 * @param timeoutMicroseconds The maximum time to wait, or `WAIT_FOREVER`.
+	 * @return `true` if a conversion is ready, `false` on timeout.
+	 */
+	virtual bool wait(uint32_t timeoutMicroseconds) noexcept = 0;
+
+	virtual ~DataReady() = default;
+};
+
+/**
+ * @brief Data-ready source fed by a DRDY edge callback.
+ *
+ * Call `onEdge()`, or pass `edge()` and this object to a C-style GPIO API, from the DRDY
+ * falling-edge interrupt. `wait()` consumes the pending edges, sleeping between checks.
+ */
+class ADS124S08::EdgeDataReady final : public DataReady {
+public:
+	/**
+	 * @param sleep Sleeps between checks for an edge, and measures the timeout. Required for
+	 * timeouts other than 0 and `WAIT_FOREVER`, which fail without it. If `nullptr`,
+	 * `WAIT_FOREVER` spins until an edge arrives.
+	 * @param context Passed to `sleep`.
+	 * @param pollMicroseconds The time between checks.
+	 */
+	explicit EdgeDataReady(
+		Sleep	 sleep			  = nullptr,
+		void	*context		  = nullptr,
+		uint32_t pollMicroseconds = 10u
+	) noexcept
+		: sleep(sleep), context(context), pollMicroseconds(pollMicroseconds) {}
+
+	/**
+	 * @brief Record a DRDY falling edge.
+	 *
+	 * @note Safe to call from interrupt context.
+	 */
+	void onEdge(void) noexcept { edges.fetch_add(1u, std::memory_order_release); }
+
+	/**
+	 * @brief Edge callback for GPIO APIs taking a function and a context.
+	 *
+	 * @param edgeDataReady The `EdgeDataReady` receiving the edge.
+	 */
+	static void edge(void *edgeDataReady) noexcept {
+		static_cast<EdgeDataReady *>(edgeDataReady)->onEdge();
+	}
+
+	bool wait(uint32_t timeoutMicroseconds) noexcept override;
+
+	/**
+	 * @brief Discard the pending edges, e.g. after changing the configuration.
+	 */
+	void clear(void) noexcept { edges.store(0u, std::memory_order_relaxed); }
+
+	/**
+	 * @brief Get the number of edges that arrived before the previous one was consumed.
+	 *
+	 * Each is a conversion that was overwritten before it was read.
+	 */
+	uint32_t overruns(void) const noexcept { return missed; }
+
+private:
+	std::atomic<uint32_t> edges{0u};
+	uint32_t			  missed{0u};
+
+	Sleep	 sleep;
+	void	*context;
+	uint32_t pollMicroseconds;
+};
+
+/**
+ * @brief Fallback data-ready source for boards without the DRDY pin wired, polling STATUS.
+ *
+ * `wait()` polls the RDY flag with `rreg(Address::STATUS)` until the device accepts commands,
+ * then waits one conversion period of the cached PGA and DATARATE configuration.
+ *
+ * @note STATUS has no new-data flag: RDY only reports that the device is ready for
+ * communication. The conversion period therefore paces the reads, and one conversion may
+ * occasionally be skipped as the polling overhead accumulates.
+ */
+class ADS124S08::StatusDataReady final : public DataReady {
+public:
+	/**
+	 * @param adc The device to poll.
+	 * @param sleep Sleeps between polls and for the conversion period. Required.
+	 * @param context Passed to `sleep`.
+	 * @param pollMicroseconds The time between STATUS polls.
+	 * @param clockHz The ADS124S08 clock frequency.
+	 */
+	StatusDataReady(
+		const ADS124S08 &adc,
+		Sleep			 sleep,
+		void			*context		  = nullptr,
+		uint32_t		 pollMicroseconds = 100u,
+		uint32_t		 clockHz		  = LatencyModel::INTERNAL_CLOCK_HZ
+	) noexcept
+		: adc(adc),
+		  sleep(sleep),
+		  context(context),
+		  pollMicroseconds(pollMicroseconds),
+		  clockHz(clockHz) {}
+
+	bool wait(uint32_t timeoutMicroseconds) noexcept override;
+
+private:
+	const ADS124S08 &adc;
+	Sleep			 sleep;
+	void			*context;
+	uint32_t		 pollMicroseconds;
+	uint32_t		 clockHz;
+};
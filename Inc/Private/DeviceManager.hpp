@@ -0,0 +1,316 @@
+#pragma once
+
+#include <atomic>
+
+/**
+ * @brief A SPI bus shared by several ADS124S08, each selected by its own chip select.
+ *
+ * The transport must not drive a chip select itself. A device holds the bus for one complete
+ * transaction, so a transaction started from another context, e.g. an interrupt, fails rather
+ * than interleaving with it.
+ */
+class ADS124S08::SharedBus {
+	SPI			   &spi;
+	std::atomic_bool owned{false};
+
+public:
+	explicit SharedBus(SPI &spi) noexcept : spi(spi) {}
+
+	SharedBus(const SharedBus &)			= delete;
+	SharedBus &operator=(const SharedBus &) = delete;
+
+	/**
+	 * @brief Take the bus for one transaction.
+	 *
+	 * @return `true` if the bus was free, `false` if a transaction is already in progress.
+	 */
+	bool acquire(void) noexcept { return !owned.exchange(true, std::memory_order_acquire); }
+
+	void release(void) noexcept { owned.store(false, std::memory_order_release); }
+
+	bool busy(void) const noexcept { return owned.load(std::memory_order_relaxed); }
+
+	SPI &transport(void) const noexcept { return spi; }
+};
+
+/**
+ * @brief SPI interface of one ADS124S08 on a `SharedBus`.
+ *
+ * Each read, write or full-duplex transfer takes the bus, asserts the chip select for its
+ * duration and releases both. Every driver operation is a single transfer, so a command is
+ * never split across chip select assertions.
+ */
+class ADS124S08::ChipSelectSPI final : public SPI {
+public:
+	/**
+	 * @brief Drive the chip select of a device.
+	 *
+	 * @param context The user context given to the constructor.
+	 * @param selected `true` to assert (drive low), `false` to deassert.
+	 */
+	using ChipSelect = void (*)(void *context, bool selected) noexcept;
+
+	ChipSelectSPI(SharedBus &bus, ChipSelect chipSelect, void *context = nullptr) noexcept
+		: bus(bus), chipSelect(chipSelect), context(context) {}
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override;
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept override;
+
+	std::optional<std::tuple<uint8_t, uint8_t>> readWrite(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count
+	) noexcept override;
+
+private:
+	SharedBus &bus;
+	ChipSelect chipSelect;
+	void	  *context;
+
+	bool select(void) noexcept;
+	void deselect(void) noexcept;
+};
+
+/**
+ * @brief Owner of many ADS124S08 on one or more shared buses, servicing them in order of
+ * readiness.
+ *
+ * DRDY edges are reported with `markReady()`, typically from the pin interrupt. `service()`
+ * then reads only the devices holding a conversion, instead of polling each in turn. Devices
+ * are visited round-robin from the one after the last serviced, so a device that is always
+ * ready cannot starve the others.
+ *
+ * With a time source, `start()` sends START to a group of devices back to back, and
+ * `markReady()` reads the time at each DRDY edge. Each conversion read afterwards is tagged with
+ * the time of its edge, so samples of different devices can be phase aligned without
+ * extrapolating from START, which drifts with the tolerance of the ADS124S08 clock.
+ *
+ * @tparam MAX_DEVICES The maximum number of devices. No memory is allocated.
+ * @note The manager refers to its own storage, so it cannot be copied or moved.
+ */
+template <std::size_t MAX_DEVICES> class ADS124S08::DeviceManager {
+	static_assert(MAX_DEVICES > 0u, "DeviceManager requires at least one device");
+
+	static constexpr std::size_t WORD_BITS	= 32u;
+	static constexpr std::size_t WORD_COUNT = (MAX_DEVICES + WORD_BITS - 1u) / WORD_BITS;
+
+public:
+	/**
+	 * @brief Read a monotonic clock.
+	 *
+	 * @param context The user context given to `setTimeSource()`.
+	 * @return The current time in nanoseconds.
+	 */
+	using TimeSource = uint64_t (*)(void *context) noexcept;
+
+	struct Sample {
+		std::size_t device; // Index returned by `addDevice()`
+		RDATA		data;
+
+		// DRDY time of the conversion, in nanoseconds of the time source, as read by
+		// `markReady()`. Devices with the same configuration share the digital filter delay, so
+		// their timestamps are directly comparable. `std::nullopt` unless the device was started
+		// with `start()`.
+		std::optional<uint64_t> timestamp;
+	};
+
+	/**
+	 * @brief Called for each conversion read by `service()`.
+	 *
+	 * @param context The user context passed to `service()`.
+	 * @param sample The conversion read.
+	 */
+	using SampleHandler = void (*)(void *context, const Sample &sample) noexcept;
+
+	DeviceManager(void) noexcept = default;
+
+	DeviceManager(const DeviceManager &)			= delete;
+	DeviceManager &operator=(const DeviceManager &) = delete;
+
+	/**
+	 * @brief Construct a device on a shared bus.
+	 *
+	 * The driver is constructed in place, reading the register file through its chip select.
+	 *
+	 * @param bus The bus the device is connected to. Must outlive the manager.
+	 * @param chipSelect Drives the chip select of the device.
+	 * @param context Passed to `chipSelect`.
+	 * @return The index of the device, or `std::nullopt` if `MAX_DEVICES` are already managed.
+	 */
+	std::optional<std::size_t>
+	addDevice(SharedBus &bus, ChipSelectSPI::ChipSelect chipSelect, void *context = nullptr) {
+		if (count == MAX_DEVICES) return std::nullopt;
+
+		Slot &slot = slots[count];
+		slot.spi.emplace(bus, chipSelect, context);
+		slot.adc.emplace(*slot.spi);
+		return count++;
+	}
+
+	std::size_t size(void) const noexcept { return count; }
+
+	ADS124S08		&device(std::size_t index) noexcept { return *slots[index].adc; }
+	const ADS124S08 &device(std::size_t index) const noexcept { return *slots[index].adc; }
+
+	/**
+	 * @brief Set the clock used to timestamp conversions.
+	 *
+	 * @param source Reads the monotonic clock. Called from `markReady()`, so it must be safe in
+	 * the context reporting DRDY edges. `nullptr` disables timestamps.
+	 * @param context Passed to `source`.
+	 */
+	void setTimeSource(TimeSource source, void *context = nullptr) noexcept {
+		timeSource		  = source;
+		timeSourceContext = context;
+	}
+
+	/**
+	 * @brief Send START to a group of devices in one tight sequence.
+	 *
+	 * The conversions read afterwards are timestamped if a time source is set.
+	 *
+	 * @param devices The indices of the devices to start.
+	 * @param count The number of devices.
+	 * @return The number of devices started.
+	 * @note Changing the PGA, DATARATE or input registers restarts the conversion, so call
+	 * `start()` again afterwards to keep the devices aligned.
+	 */
+	std::size_t start(const std::size_t *const devices, std::size_t count) noexcept {
+		return forEach(devices, count, [this](std::size_t index) {
+			Slot &slot = slots[index];
+			slot.timed = slot.adc->start().has_value();
+			return slot.timed;
+		});
+	}
+
+	/**
+	 * @brief Send START to every device.
+	 */
+	std::size_t start(void) noexcept { return start(nullptr, count); }
+
+	/**
+	 * @brief Send STOP to a group of devices in one tight sequence.
+	 *
+	 * @return The number of devices stopped.
+	 */
+	std::size_t stop(const std::size_t *const devices, std::size_t count) noexcept {
+		return forEach(devices, count, [this](std::size_t index) {
+			slots[index].timed = false;
+			return slots[index].adc->stop().has_value();
+		});
+	}
+
+	/**
+	 * @brief Send STOP to every device.
+	 */
+	std::size_t stop(void) noexcept { return stop(nullptr, count); }
+
+	/**
+	 * @brief Record that a device has a conversion ready, and the time of its DRDY edge.
+	 *
+	 * @note Safe to call from interrupt context. Call as close to the edge as possible, as the
+	 * time read here is the timestamp of the conversion.
+	 */
+	void markReady(std::size_t index) noexcept {
+		if (index >= count) return;
+		if (timeSource != nullptr) {
+			slots[index].edgeTime.store(timeSource(timeSourceContext), std::memory_order_relaxed);
+		}
+		ready[index / WORD_BITS].fetch_or(bit(index), std::memory_order_release);
+	}
+
+	bool isReady(std::size_t index) const noexcept {
+		if (index >= count) return false;
+		return ready[index / WORD_BITS].load(std::memory_order_acquire) & bit(index);
+	}
+
+	/**
+	 * @brief Read the conversions of the ready devices.
+	 *
+	 * Devices marked ready while servicing are also read, up to `limit` reads.
+	 *
+	 * @param handler Called with each conversion read. May be `nullptr`.
+	 * @param context Passed to `handler`.
+	 * @param mode The conversion read method.
+	 * @param limit The maximum number of devices to read.
+	 * @return The number of conversions read successfully. A failed read clears the ready flag
+	 * of the device, which is set again by its next DRDY edge.
+	 */
+	std::size_t service(
+		SampleHandler handler,
+		void		 *context = nullptr,
+		DataReadMode  mode	  = DataReadMode::COMMAND,
+		std::size_t	  limit	  = SIZE_MAX
+	) noexcept {
+		std::size_t successes = 0u;
+		for (std::size_t reads = 0u; reads < limit; reads++) {
+			const auto index = takeNextReady();
+			if (!index) break;
+
+			// Taken before the read, as an edge during the read or the handler is the next sample
+			const auto time	  = timestamp(*index);
+			const auto result = slots[*index].adc->rdata(mode);
+			if (!result) continue;
+
+			successes++;
+			if (handler != nullptr) handler(context, Sample{*index, *result, time});
+		}
+		return successes;
+	}
+
+private:
+	struct Slot {
+		std::optional<ChipSelectSPI> spi{};
+		std::optional<ADS124S08>	 adc{};
+
+		bool				  timed{false}; // Started with `start()`
+		std::atomic<uint64_t> edgeTime{0u}; // Time of the last DRDY edge
+	};
+
+	std::array<Slot, MAX_DEVICES>				   slots{};
+	std::size_t									   count{0u};
+	std::size_t									   cursor{0u}; // Next device to consider first
+	std::array<std::atomic<uint32_t>, WORD_COUNT> ready{};
+
+	TimeSource timeSource{nullptr};
+	void	  *timeSourceContext{nullptr};
+
+	// Apply `action` to the listed devices, or to the first `count` devices if `nullptr`
+	template <typename ACTION>
+	std::size_t forEach(const std::size_t *const devices, std::size_t count, ACTION action) {
+		std::size_t successes = 0u;
+		for (std::size_t i = 0u; i < count; i++) {
+			const std::size_t index = devices == nullptr ? i : devices[i];
+			if (index >= this->count) continue;
+			if (action(index)) successes++;
+		}
+		return successes;
+	}
+
+	// The DRDY time of the conversion held by a device
+	std::optional<uint64_t> timestamp(std::size_t index) const noexcept {
+		const Slot &slot = slots[index];
+		if (!slot.timed || timeSource == nullptr) return std::nullopt;
+		return slot.edgeTime.load(std::memory_order_relaxed);
+	}
+
+	static constexpr uint32_t bit(std::size_t index) noexcept {
+		return 1ul << (index % WORD_BITS);
+	}
+
+	// Clear and return the first ready device at or after the cursor
+	std::optional<std::size_t> takeNextReady(void) noexcept {
+		for (std::size_t offset = 0u; offset < count; offset++) {
+			const std::size_t index = (cursor + offset) % count;
+			const uint32_t	  mask	= bit(index);
+
+			auto &word = ready[index / WORD_BITS];
+			if (!(word.load(std::memory_order_acquire) & mask)) continue;
+
+			word.fetch_and(~mask, std::memory_order_acq_rel);
+			cursor = (index + 1u) % count;
+			return index;
+		}
+		return std::nullopt;
+	}
+};
@@ -0,0 +1,131 @@
+#pragma once
+
+/**
+ * @brief Precomputed integer scale converting raw codes to microvolts or nanovolts.
+ *
+ * An alternative to `RDATA::toVoltage()` for targets without an FPU. The PGA gain is a power of
+ * two, so each conversion is one integer multiply by the reference voltage and one shift, with
+ * no division. Construct once per configuration, e.g. as a `static constexpr`.
+ */
+class ADS124S08::FixedPointScale {
+public:
+	static constexpr uint32_t INTERNAL_REFERENCE_MICROVOLTS = 2500000u;
+
+private:
+	static constexpr uint8_t FULL_SCALE_BITS = 23u; // 2^23 codes per polarity
+
+	int64_t vRefMicrovolts;
+	int64_t vRefNanovolts;
+	uint8_t shift; // 23 + log2(gain)
+
+	static constexpr int32_t signExtend(const uint32_t code) noexcept {
+		return static_cast<int32_t>(code << 8u) >> 8u;
+	}
+
+	// Round to nearest, with halves rounded towards positive infinity
+	constexpr int64_t scale(const uint32_t code, const int64_t reference) const noexcept {
+		return (signExtend(code) * reference + (int64_t{1} << (shift - 1u))) >> shift;
+	}
+
+public:
+	/**
+	 * @brief Construct a scale from the PGA gain and reference voltage.
+	 *
+	 * @param gain The PGA gain. Use `GAIN_1` when the PGA is bypassed.
+	 * @param vRefMicrovolts The differential reference voltage in microvolts.
+	 */
+	constexpr FixedPointScale(
+		PGA::GAIN_SELECT gain,
+		uint32_t		 vRefMicrovolts = INTERNAL_REFERENCE_MICROVOLTS
+	) noexcept
+		: vRefMicrovolts(vRefMicrovolts),
+		  vRefNanovolts(int64_t{vRefMicrovolts} * 1000),
+		  shift(FULL_SCALE_BITS + static_cast<uint8_t>(gain)) {}
+
+	/**
+	 * @brief Construct a scale from the PGA gain and reference selection.
+	 *
+	 * @param gain The PGA gain. Use `GAIN_1` when the PGA is bypassed.
+	 * @param ref The reference input selection.
+	 * @param externalRefMicrovolts The external reference voltage in microvolts, used unless the
+	 * internal reference is selected.
+	 */
+	constexpr FixedPointScale(
+		PGA::GAIN_SELECT			 gain,
+		REF::InternalReferenceSelect ref,
+		uint32_t					 externalRefMicrovolts
+	) noexcept
+		: FixedPointScale(
+			  gain,
+			  (ref == REF::InternalReferenceSelect::INTERNAL) ? INTERNAL_REFERENCE_MICROVOLTS
+															  : externalRefMicrovolts
+		  ) {}
+
+	/**
+	 * @brief Construct a scale from the PGA and REF register configuration.
+	 *
+	 * @param pga The PGA register. A bypassed PGA is treated as unity gain.
+	 * @param ref The REF register.
+	 * @param externalRefMicrovolts The external reference voltage in microvolts, used unless the
+	 * internal reference is selected.
+	 */
+	FixedPointScale(
+		const PGA &pga,
+		const REF &ref,
+		uint32_t   externalRefMicrovolts = INTERNAL_REFERENCE_MICROVOLTS
+	) noexcept
+		: FixedPointScale(
+			  (pga.getEnable() == PGA::ENABLE::BYPASSED) ? PGA::GAIN_SELECT::GAIN_1
+														 : pga.getGain(),
+			  ref.getReferenceInputSelection(),
+			  externalRefMicrovolts
+		  ) {}
+
+	/**
+	 * @brief Convert a raw 24-bit code to nanovolts.
+	 *
+	 * @param code Raw 24-bit two's complement code, as in `RDATA::data`.
+	 */
+	constexpr int64_t toNanovolts(const uint32_t code) const noexcept {
+		return scale(code, vRefNanovolts);
+	}
+
+	/**
+	 * @brief Convert a raw 24-bit code to microvolts.
+	 *
+	 * @param code Raw 24-bit two's complement code, as in `RDATA::data`.
+	 */
+	constexpr int32_t toMicrovolts(const uint32_t code) const noexcept {
+		return static_cast<int32_t>(scale(code, vRefMicrovolts));
+	}
+
+	/**
+	 * @brief Convert an array of raw 24-bit codes to microvolts.
+	 *
+	 * @param codes Raw 24-bit two's complement codes.
+	 * @param microvolts An array to store `count` results.
+	 * @param count The number of codes to convert.
+	 */
+	void toMicrovolts(
+		const uint32_t *const codes,
+		int32_t *const		  microvolts,
+		const std::size_t	  count
+	) const noexcept {
+		for (std::size_t i = 0u; i < count; i++) microvolts[i] = toMicrovolts(codes[i]);
+	}
+
+	/**
+	 * @brief Convert an array of raw 24-bit codes to nanovolts.
+	 *
+	 * @param codes Raw 24-bit two's complement codes.
+	 * @param nanovolts An array to store `count` results.
+	 * @param count The number of codes to convert.
+	 */
+	void toNanovolts(
+		const uint32_t *const codes,
+		int64_t *const		  nanovolts,
+		const std::size_t	  count
+	) const noexcept {
+		for (std::size_t i = 0u; i < count; i++) nanovolts[i] = toNanovolts(codes[i]);
+	}
+};
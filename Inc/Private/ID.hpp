@@ -2,19 +2,25 @@
 
 using Register = ADS124S08::SPI::Register;
 
-struct ADS124S08::ID : SPI_Register_I {
+struct ADS124S08::ID final : SPI_Register_I {
 private:
-	static const Address  ADDRESS{0x00u};
-	static const Register RESET_VALUE{0x00u};
+	using DEV_ID = RegisterField<0u, 3u>; // Device ID
 
-	const Register DEV_ID : 3; // Device ID
+public:
+	using Descriptor = RegisterDescriptor<Address::ID, 0x00u, DEV_ID>;
+
+private:
+	static constexpr Address  ADDRESS	  = Descriptor::address;
+	static constexpr Register RESET_VALUE = Descriptor::resetValue;
+
+	Register reg;
 
 public:
-	virtual Register toRegister(void) const override;
+	constexpr Register value(void) const noexcept { return reg; }
 
-	ID(Register id = ID::RESET_VALUE) : DEV_ID(id) {}
+	virtual Register toRegister(void) const override { return value(); }
 
-	virtual ~ID() = default;
+	constexpr ID(Register id = ID::RESET_VALUE) : reg(Descriptor::pack(id)) {}
 
 	enum class DeviceID : Register {
 		ADS124S08 = 0b000u, // ADS124S08 Device ID
@@ -22,7 +28,9 @@ public:
 							// 0b010u to 0b111u Reserved
 	};
 
-	DeviceID getDeviceID(void) const { return static_cast<DeviceID>(DEV_ID); }
+	constexpr DeviceID getDeviceID(void) const {
+		return static_cast<DeviceID>(DEV_ID::unpack(reg));
+	}
 
 	virtual Address	 getAddress(void) const override { return this->ADDRESS; }
 	virtual Register getResetValue(void) const override { return ID::RESET_VALUE; }
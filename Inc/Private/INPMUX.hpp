@@ -4,13 +4,19 @@
  * @brief Input multiplexer configuration for the ADS124S08.
  *
  */
-struct ADS124S08::INPMUX : SPI_Register_I {
+struct ADS124S08::INPMUX final : SPI_Register_I {
 private:
-	static const Address  ADDRESS{0x02u};
-	static const Register RESET_VALUE{0x01u};
+	using MUXP = RegisterField<4u, 4u>; // Positive Input Channel Selection
+	using MUXN = RegisterField<0u, 4u>; // Negative Input Channel Selection
 
-	Register MUXP : 4; // Positive Input Channel Selection
-	Register MUXN : 4; // Negative Input Channel Selection
+public:
+	using Descriptor = RegisterDescriptor<Address::INP_MUX, 0x01u, MUXP, MUXN>;
+
+private:
+	static constexpr Address  ADDRESS	  = Descriptor::address;
+	static constexpr Register RESET_VALUE = Descriptor::resetValue;
+
+	Register reg;
 
 public:
 	enum class InputSelect : Register {
@@ -30,21 +36,31 @@ public:
 		// Reserved 0b1101u - 0b1110u
 	};
 
-	INPMUX(Register val = INPMUX::RESET_VALUE);
-	INPMUX(InputSelect posChannel, InputSelect negChannel);
+	constexpr INPMUX(Register val = INPMUX::RESET_VALUE) : reg(val) {}
+	constexpr INPMUX(InputSelect posChannel, InputSelect negChannel)
+		: reg(Descriptor::pack(posChannel, negChannel)) {}
 
 #ifdef ADS124S08_GTEST_TESTING
 	FRIEND_TEST(INPMUX_Test, constructor_InitializesFieldsCorrectly_FromRegister);
 	FRIEND_TEST(INPMUX_Test, constructor_InitializesFieldsCorrectly_FromInputSelect);
 #endif
 
-	virtual ~INPMUX() = default;
+	/**
+	 * @brief Get the packed register value. Usable in constant expressions.
+	 */
+	constexpr Register value(void) const noexcept { return reg; }
 
-	virtual Register toRegister(void) const override;
+	virtual Register toRegister(void) const override { return value(); }
 
-	INPMUX &setPositiveInputChannel(InputSelect channel);
+	constexpr INPMUX &setPositiveInputChannel(InputSelect channel) {
+		reg = MUXP::insert(reg, static_cast<Register>(channel));
+		return *this;
+	}
 
-	INPMUX &setNegativeInputChannel(InputSelect channel);
+	constexpr INPMUX &setNegativeInputChannel(InputSelect channel) {
+		reg = MUXN::insert(reg, static_cast<Register>(channel));
+		return *this;
+	}
 
 	virtual Address	 getAddress(void) const override { return ADDRESS; }
 	virtual Register getResetValue(void) const override { return RESET_VALUE; }
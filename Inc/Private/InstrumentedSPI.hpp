@@ -0,0 +1,151 @@
+#pragma once
+
+/**
+ * @brief Compile-time switch for `InstrumentedSPI`. When 0, nothing is recorded and `bus()`
+ * returns the wrapped transport, so the driver calls it directly.
+ */
+#ifndef ADS124S08_INSTRUMENTATION
+#define ADS124S08_INSTRUMENTATION 1
+#endif
+
+/**
+ * @brief `SPI` wrapper recording counts, bytes, failures and latency per operation.
+ *
+ * Each transfer is classified by its first transmitted byte. With a time source, its duration
+ * is added to a log2 histogram of the operation and reported to the tracer, so the SPI latency
+ * can be told apart from DRDY jitter or a slow consumer:
+ *
+ * @code
+ * ADS124S08::InstrumentedSPI instrumented{spi, monotonicNanoseconds};
+ * ADS124S08 adc{instrumented.bus()};
+ * ...
+ * const auto rdata = instrumented.snapshot()[ADS124S08::InstrumentedSPI::Operation::RDATA];
+ * @endcode
+ *
+ * @note The counters are not synchronised. Take snapshots from the thread performing the
+ * transfers, or while it is idle.
+ */
+class ADS124S08::InstrumentedSPI final : public SPI {
+public:
+	static constexpr bool	 ENABLED		   = ADS124S08_INSTRUMENTATION != 0;
+	static constexpr uint8_t HISTOGRAM_BUCKETS = 16u;
+	static constexpr uint8_t HISTOGRAM_SHIFT   = 8u; // Bucket 0 holds durations below 256 ns
+
+	/**
+	 * @brief Read a monotonic clock.
+	 *
+	 * @param context The user context given to the constructor.
+	 * @return The current time in nanoseconds.
+	 */
+	using TimeSource = uint64_t (*)(void *context) noexcept;
+
+	enum class Operation : uint8_t {
+		RREG,
+		WREG,
+		RDATA,	 // RDATA command and direct reads
+		COMMAND, // Control and calibration commands
+	};
+	static constexpr uint8_t OPERATION_COUNT = 4u;
+
+	struct Trace {
+		Operation operation;
+		Register  opcode;	// First byte transmitted, NOP for direct reads
+		uint8_t	  count;	// Bytes requested
+		bool	  success;
+		uint64_t  start;	// Nanoseconds, 0 without a time source
+		uint32_t  duration; // Nanoseconds, 0 without a time source
+	};
+
+	/**
+	 * @brief Called after each transfer, in the context performing it.
+	 */
+	using Tracer = void (*)(void *context, const Trace &trace) noexcept;
+
+	struct OperationStatistics {
+		uint32_t count;
+		uint32_t failures;
+		uint64_t bytes;
+		uint64_t totalNanoseconds;
+		uint32_t minNanoseconds; // UINT32_MAX until a duration is recorded
+		uint32_t maxNanoseconds;
+
+		/**
+		 * @brief Transfers by duration. Bucket `i > 0` holds durations in
+		 * [2^(i + HISTOGRAM_SHIFT - 1), 2^(i + HISTOGRAM_SHIFT)) ns; the last bucket is unbounded.
+		 */
+		std::array<uint32_t, HISTOGRAM_BUCKETS> histogram;
+	};
+
+	struct Snapshot {
+		std::array<OperationStatistics, OPERATION_COUNT> operations;
+
+		const OperationStatistics &operator[](Operation operation) const noexcept {
+			return operations[static_cast<uint8_t>(operation)];
+		}
+	};
+
+	/**
+	 * @param spi The transport to instrument.
+	 * @param timeSource Reads the clock timing each transfer. `nullptr` records no latency.
+	 * @param context Passed to `timeSource`.
+	 */
+	explicit InstrumentedSPI(SPI &spi, TimeSource timeSource = nullptr, void *context = nullptr)
+		noexcept;
+
+	/**
+	 * @brief Get the transport to construct the driver with: this wrapper when instrumentation is
+	 * enabled, the wrapped transport otherwise.
+	 */
+	SPI &bus(void) noexcept {
+		if constexpr (ENABLED) return *this;
+		else return spi;
+	}
+
+	void setTracer(Tracer tracer, void *context = nullptr) noexcept;
+
+	/**
+	 * @brief Copy the statistics accumulated since construction or the last `reset()`.
+	 */
+	Snapshot snapshot(void) const noexcept { return statistics; }
+
+	void reset(void) noexcept;
+
+	/**
+	 * @brief Classify a transfer by its first transmitted byte.
+	 */
+	static Operation classify(Register opcode) noexcept;
+
+	/**
+	 * @brief Get the histogram bucket of a duration.
+	 */
+	static uint8_t bucket(uint32_t nanoseconds) noexcept;
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override;
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept override;
+
+	std::optional<std::tuple<uint8_t, uint8_t>> readWrite(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count
+	) noexcept override;
+
+private:
+	SPI			  &spi;
+	const TimeSource timeSource;
+	void *const		 timeSourceContext;
+
+	Tracer tracer{nullptr};
+	void  *tracerContext{nullptr};
+
+	Snapshot statistics{};
+
+	uint64_t now(void) const noexcept;
+
+	void record(
+		Register opcode,
+		uint8_t	 count,
+		uint8_t	 transferred,
+		bool	 success,
+		uint64_t start
+	) noexcept;
+};
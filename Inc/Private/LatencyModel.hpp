@@ -0,0 +1,118 @@
+#pragma once
+
+/**
+ * @brief Conversion latency model and settling-aware configuration scheduler.
+ *
+ * After a configuration change (WREG or START) the device waits the PGA conversion delay and
+ * then runs the digital filter until it has settled, so the first DRDY is delayed beyond the
+ * normal data period. Times are in modulator clock periods, t_MOD = 16 / f_CLK (3.90625 us with
+ * the internal oscillator).
+ *
+ * @note Refer to the ADS124S08 §9.3.6 "Digital Filter" and §9.4.4 "Conversion Latency".
+ */
+struct ADS124S08::LatencyModel {
+	static constexpr uint32_t INTERNAL_CLOCK_HZ = 4096000u;
+	static constexpr uint32_t MODULATOR_DIVIDER = 16u;
+
+	using CONVERSION_DELAY = PGA::CONVERSION_DELAY;
+	using DataRate		   = DATARATE::DataRate;
+	using FilterSelect	   = DATARATE::FilterSelect;
+	using ChopperEnable	   = DATARATE::ChopperEnable;
+
+	struct Latency {
+		uint32_t firstSample; // t_MOD from the configuration change to the first settled DRDY
+		uint32_t period;	  // t_MOD between subsequent DRDYs in continuous conversion mode
+
+		uint32_t firstSampleMicroseconds(uint32_t clockHz = INTERNAL_CLOCK_HZ) const noexcept;
+		uint32_t periodMicroseconds(uint32_t clockHz = INTERNAL_CLOCK_HZ) const noexcept;
+	};
+
+	/**
+	 * @brief Convert a duration in t_MOD to nanoseconds, rounded to the nearest.
+	 */
+	static uint64_t nanoseconds(uint32_t tMod, uint32_t clockHz = INTERNAL_CLOCK_HZ) noexcept;
+
+	/**
+	 * @brief Get the conversion delay in t_MOD.
+	 */
+	static uint32_t conversionDelay(CONVERSION_DELAY delay) noexcept;
+
+	/**
+	 * @brief Get the decimation ratio, i.e. the data period in t_MOD.
+	 */
+	static uint32_t decimationRatio(DataRate rate) noexcept;
+
+	/**
+	 * @brief Get the number of data periods for the filter to settle after a reset.
+	 *
+	 * @return 3 for the SINC3 filter, 1 for the low-latency filter.
+	 */
+	static uint8_t settlingPeriods(FilterSelect filter) noexcept;
+
+	/**
+	 * @brief Get the -3 dB bandwidth of the digital filter.
+	 *
+	 * @param rate The data rate.
+	 * @param filter The digital filter.
+	 * @param clockHz The clock frequency. Scales the bandwidth from its nominal value.
+	 * @return The bandwidth in Hz. Used as the noise bandwidth when scheduling.
+	 */
+	static float bandwidth(
+		DataRate	 rate,
+		FilterSelect filter,
+		uint32_t	 clockHz = INTERNAL_CLOCK_HZ
+	) noexcept;
+
+	/**
+	 * @brief Compute the conversion latency of a configuration.
+	 *
+	 * @note With global chop enabled, each result averages two settled conversions taken with
+	 * the inputs swapped, each preceded by the conversion delay.
+	 */
+	static Latency compute(
+		CONVERSION_DELAY delay,
+		DataRate		 rate,
+		FilterSelect	 filter,
+		ChopperEnable	 chop = ChopperEnable::DISABLED
+	) noexcept;
+
+	static Latency compute(const PGA &pga, const DATARATE &datarate) noexcept;
+
+	/**
+	 * @brief Constraints for `schedule()`.
+	 */
+	struct Requirements {
+		uint32_t settlingMicroseconds = 0u;			// Analog settling needed after a mux change
+		float	 minBandwidth		  = 0.0f;		// Lowest acceptable -3 dB bandwidth in Hz
+		float	 maxBandwidth		  = 1.0e9f;		// Highest acceptable -3 dB bandwidth in Hz
+		bool	 globalChop			  = false;		// Require global chop for offset drift
+		uint32_t clockHz			  = INTERNAL_CLOCK_HZ;
+	};
+
+	struct Configuration {
+		CONVERSION_DELAY delay;
+		DataRate		 rate;
+		FilterSelect	 filter;
+		ChopperEnable	 chop;
+		Latency			 latency;
+
+		/**
+		 * @brief Apply the configuration to the PGA and DATARATE registers.
+		 *
+		 * @note Only the delay, data rate, filter and chop fields are modified.
+		 */
+		void apply(PGA &pga, DATARATE &datarate) const noexcept;
+	};
+
+	/**
+	 * @brief Find the configuration with the shortest time to the first settled conversion.
+	 *
+	 * The shortest conversion delay covering the analog settling time is chosen, then every data
+	 * rate and filter within the bandwidth limits is considered. Ties are broken by the lower
+	 * bandwidth.
+	 *
+	 * @return The fastest configuration, or `std::nullopt` if no configuration meets the
+	 * requirements.
+	 */
+	static std::optional<Configuration> schedule(const Requirements &requirements) noexcept;
+};
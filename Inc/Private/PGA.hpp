@@ -2,23 +2,27 @@
 
 using Register = ADS124S08::SPI::Register;
 
-struct ADS124S08::PGA : SPI_Register_I {
+struct ADS124S08::PGA final : SPI_Register_I {
 private:
-	static const Address  ADDRESS{0x03u};
-	static const Register RESET_VALUE{0x00u};
+	using DELAY	 = RegisterField<5u, 3u>;
+	using PGA_EN = RegisterField<3u, 2u>;
+	using GAIN	 = RegisterField<0u, 3u>;
 
-	Register DELAY	: 3;
-	Register PGA_EN : 2;
-	Register GAIN	: 3;
+public:
+	using Descriptor = RegisterDescriptor<Address::PGA, 0x00u, DELAY, PGA_EN, GAIN>;
+
+private:
+	static constexpr Address  ADDRESS	  = Descriptor::address;
+	static constexpr Register RESET_VALUE = Descriptor::resetValue;
+
+	Register reg;
 
 public:
-	PGA(Register val = RESET_VALUE);
+	constexpr PGA(Register val = RESET_VALUE) : reg(val) {}
 
 #ifdef ADS124S08_GTEST_TESTING
-	PGA(const std::array<Register, 3> &vals)
-		: DELAY(vals[0]),  //
-		  PGA_EN(vals[1]), //
-		  GAIN(vals[2]) {}
+	constexpr PGA(const std::array<Register, 3> &vals)
+		: reg(Descriptor::pack(vals[0], vals[1], vals[2])) {}
 
 	friend class PGA_Test;
 	FRIEND_TEST(PGA_Test, constructor_InitializesFieldsCorrectly_FromRegister);
@@ -41,7 +45,14 @@ public:
 		DELAY_1	   = 0B111u,
 	};
 
-	PGA &setDelay(CONVERSION_DELAY delay);
+	constexpr PGA &setDelay(CONVERSION_DELAY delay) {
+		reg = DELAY::insert(reg, static_cast<Register>(delay));
+		return *this;
+	}
+
+	constexpr CONVERSION_DELAY getDelay(void) const {
+		return static_cast<CONVERSION_DELAY>(DELAY::unpack(reg));
+	}
 
 	/**
 	 * @brief Enables or bypasses the PGA.
@@ -53,7 +64,14 @@ public:
 		// 0b10 and 0b11 are reserved
 	};
 
-	PGA &setEnable(ENABLE enable, bool setUnityGainIfBypassed = true);
+	constexpr PGA &setEnable(ENABLE enable, bool setUnityGainIfBypassed = true) {
+		reg = PGA_EN::insert(reg, static_cast<Register>(enable));
+		if (enable == ENABLE::BYPASSED && setUnityGainIfBypassed)
+			reg = GAIN::insert(reg, static_cast<Register>(GAIN_SELECT::GAIN_1));
+		return *this;
+	}
+
+	constexpr ENABLE getEnable(void) const { return static_cast<ENABLE>(PGA_EN::unpack(reg)); }
 
 	/**
 	 * @brief Configures the PGA gain.
@@ -70,9 +88,23 @@ public:
 		GAIN_128 = 0b111u,
 	};
 
-	PGA &setGain(GAIN_SELECT gain, bool setPGAEnabledIfGainNotUnity = true);
+	constexpr PGA &setGain(GAIN_SELECT gain, bool setPGAEnabledIfGainNotUnity = true) {
+		reg = GAIN::insert(reg, static_cast<Register>(gain));
+		if (gain != GAIN_SELECT::GAIN_1 && setPGAEnabledIfGainNotUnity)
+			reg = PGA_EN::insert(reg, static_cast<Register>(ENABLE::ENABLED));
+		return *this;
+	}
+
+	constexpr GAIN_SELECT getGain(void) const {
+		return static_cast<GAIN_SELECT>(GAIN::unpack(reg));
+	}
+
+	/**
+	 * @brief Get the packed register value. Usable in constant expressions.
+	 */
+	constexpr Register value(void) const noexcept { return reg; }
 
-	Register		 toRegister(void) const override;
+	Register		 toRegister(void) const override { return value(); }
 	virtual Address	 getAddress(void) const override { return ADDRESS; }
 	virtual Register getResetValue(void) const override { return RESET_VALUE; }
 };
@@ -4,29 +4,40 @@
  * @brief Configuration representation of the ADS124S08 REF register (Address 0x05).
  *
  */
-struct ADS124S08::REF : SPI_Register_I {
+struct ADS124S08::REF final : SPI_Register_I {
 private:
-	static const Address  ADDRESS{0x05u};
-	static const Register RESET_VALUE{0x10u};
+	using FL_REF_EN = RegisterField<6u, 2u>; // Reference Monitor Configuration
+	using REFP_BUF	= RegisterField<5u, 1u>; // Positive Reference Buffer Bypass
+	using REFN_BUF	= RegisterField<4u, 1u>; // Negative Reference Buffer Bypass
+	using REFSEL	= RegisterField<2u, 2u>; // Reference Input Selection
+	using REFCON	= RegisterField<0u, 2u>; // Internal Reference Configuration
 
-	Register FL_REF_EN : 2; // Reference Monitor Configuration
-	Register REFP_BUF  : 1; // Positive Reference Buffer Bypass
-	Register REFN_BUF  : 1; // Negative Reference Buffer Bypass
-	Register REFSEL	   : 2; // Reference Input Selection
-	Register REFCON	   : 2; // Internal Reference Configuration
+public:
+	using Descriptor =
+		RegisterDescriptor<Address::REF, 0x10u, FL_REF_EN, REFP_BUF, REFN_BUF, REFSEL, REFCON>;
+
+private:
+	static constexpr Address  ADDRESS	  = Descriptor::address;
+	static constexpr Register RESET_VALUE = Descriptor::resetValue;
+
+	Register reg;
 
 public:
-	virtual Register toRegister(void) const override;
+	/**
+	 * @brief Get the packed register value. Usable in constant expressions.
+	 */
+	constexpr Register value(void) const noexcept { return reg; }
 
-	REF(Register val = REF::RESET_VALUE);
+	virtual Register toRegister(void) const override { return value(); }
+
+	constexpr REF(Register val = REF::RESET_VALUE) : reg(val) {}
 
 #ifdef ADS124S08_GTEST_TESTING
 	//? Only to be used for unit testing
-	constexpr REF(const std::array<Register, 5> &vals);
+	constexpr REF(const std::array<Register, 5> &vals)
+		: reg(Descriptor::pack(vals[0], vals[1], vals[2], vals[3], vals[4])) {}
 #endif
 
-	virtual ~REF() = default;
-
 	enum class ReferenceMonitorConfig : Register {
 		DISABLED				   = 0b00u, // Reference Monitor Disabled
 		LEVEL_0_ONLY			   = 0b01u, // Level 0 enabled, threshold 0.3V.
@@ -36,7 +47,10 @@ public:
 		LEVEL_0_10MR_PULL_TOGETHER = 0b11u,
 	};
 
-	REF &setReferenceMonitorConfig(ReferenceMonitorConfig config);
+	constexpr REF &setReferenceMonitorConfig(ReferenceMonitorConfig config) {
+		reg = FL_REF_EN::insert(reg, static_cast<Register>(config));
+		return *this;
+	}
 
 	enum class BufferBypassConfig : Register {
 		ENABLED	 = 0b0u, // Bypass is Enabled
@@ -52,7 +66,10 @@ public:
 	 *! @note `setReferenceInputSelection()` for possible side effects affecting the
 	 * reference buffers.
 	 */
-	REF &setPositiveRefBufferBypass(BufferBypassConfig bypass);
+	constexpr REF &setPositiveRefBufferBypass(BufferBypassConfig bypass) {
+		reg = REFP_BUF::insert(reg, static_cast<Register>(bypass));
+		return *this;
+	}
 
 	/** @brief Enable or disable the negative reference buffer bypass.
 	 *
@@ -62,7 +79,10 @@ public:
 	 *! @note `setReferenceInputSelection()` for possible side effects affecting the
 	 * reference buffers.
 	 */
-	REF &setNegativeRefBufferBypass(BufferBypassConfig bypass);
+	constexpr REF &setNegativeRefBufferBypass(BufferBypassConfig bypass) {
+		reg = REFN_BUF::insert(reg, static_cast<Register>(bypass));
+		return *this;
+	}
 
 	enum class InternalReferenceSelect : Register {
 		REFP0_REFN0 = 0b00u, // Use REFP0 and REFN0 Inputs
@@ -80,10 +100,22 @@ public:
 	 *
 	 * @return This REF object reference.
 	 */
-	REF &setReferenceInputSelection(
+	constexpr REF &setReferenceInputSelection(
 		InternalReferenceSelect sel, //
 		bool					disableBuffersIfInternalSelected = true
-	);
+	) {
+		reg = REFSEL::insert(reg, static_cast<Register>(sel));
+		if (sel == InternalReferenceSelect::INTERNAL && disableBuffersIfInternalSelected) {
+			// Reference buffers must be disabled when using internal reference
+			reg = REFN_BUF::insert(reg, 0b1u);
+			reg = REFP_BUF::insert(reg, 0b1u);
+		}
+		return *this;
+	}
+
+	constexpr InternalReferenceSelect getReferenceInputSelection(void) const {
+		return static_cast<InternalReferenceSelect>(REFSEL::unpack(reg));
+	}
 
 	enum class IntRefVoltConfig : Register {
 		OFF		   = 0b00u, // Internal Reference Off
@@ -98,7 +130,10 @@ public:
 	 * @param config
 	 * @return This REF object reference.
 	 */
-	REF &setInternalReferenceVoltageConfig(IntRefVoltConfig config);
+	constexpr REF &setInternalReferenceVoltageConfig(IntRefVoltConfig config) {
+		reg = REFCON::insert(reg, static_cast<Register>(config));
+		return *this;
+	}
 
 	virtual Address	 getAddress(void) const override { return ADDRESS; }
 	virtual Register getResetValue(void) const override { return RESET_VALUE; }
@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * @brief Compile-time description of a bit field within a register.
+ *
+ * @tparam SHIFT The position of the least significant bit of the field.
+ * @tparam WIDTH The number of bits in the field.
+ */
+template <uint8_t SHIFT, uint8_t WIDTH> struct ADS124S08::RegisterField {
+	static_assert(WIDTH > 0u && SHIFT + WIDTH <= 8u, "Field must lie within an 8-bit register");
+
+	static constexpr uint8_t  shift = SHIFT;
+	static constexpr uint8_t  width = WIDTH;
+	static constexpr Register mask	= static_cast<Register>(((1u << WIDTH) - 1u) << SHIFT);
+
+	/**
+	 * @brief Place a field value at its position. Excess bits are discarded.
+	 */
+	static constexpr Register pack(Register value) noexcept {
+		return static_cast<Register>((value << SHIFT) & mask);
+	}
+
+	/**
+	 * @brief Extract the field value from a register value.
+	 */
+	static constexpr Register unpack(Register reg) noexcept {
+		return static_cast<Register>((reg & mask) >> SHIFT);
+	}
+
+	/**
+	 * @brief Replace the field within a register value, leaving the other bits unchanged.
+	 */
+	static constexpr Register insert(Register reg, Register value) noexcept {
+		return static_cast<Register>((reg & ~mask) | pack(value));
+	}
+};
+
+/**
+ * @brief Compile-time description of a register: its address, reset value and field layout.
+ *
+ * Every register struct exposes its descriptor as `Descriptor`, which allows register values to
+ * be built as constant expressions and written without any virtual dispatch, e.g.
+ * `adc.wreg(INPMUX::Descriptor::address, INPMUX::Descriptor::pack(AIN0, AINCOM))`.
+ *
+ * @tparam ADDRESS The register address.
+ * @tparam RESET_VALUE The register value after reset.
+ * @tparam FIELDS The `RegisterField`s, most significant first.
+ */
+template <ADS124S08::Address ADDRESS, ADS124S08::Register RESET_VALUE, typename... FIELDS>
+struct ADS124S08::RegisterDescriptor {
+	static_assert(ADDRESS < REGISTER_COUNT, "Register address out of range");
+
+	static constexpr Address  address	 = ADDRESS;
+	static constexpr Register resetValue = RESET_VALUE;
+	static constexpr Register fieldMask	 = static_cast<Register>((0u | ... | FIELDS::mask));
+
+	/**
+	 * @brief Pack one value per field, in the order of `FIELDS`, into a register value.
+	 *
+	 * @param values The field values. Enumerations are converted to their underlying value.
+	 */
+	template <typename... VALUES> static constexpr Register pack(VALUES... values) noexcept {
+		static_assert(sizeof...(VALUES) == sizeof...(FIELDS), "One value is required per field");
+		return static_cast<Register>((0u | ... | FIELDS::pack(static_cast<Register>(values))));
+	}
+};
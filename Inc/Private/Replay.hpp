@@ -0,0 +1,155 @@
+#pragma once
+
+/**
+ * @brief SPI traffic log written by `RecordingSPI` and replayed by `ReplaySPI`.
+ *
+ * The log is `HEADER_SIZE` bytes, `MAGIC` then `VERSION`, followed by one entry per transfer:
+ * a kind byte, the byte count, the byte counts the transport returned unless the transfer failed
+ * (read then written for `READ_WRITE`, a single count otherwise), the transmitted bytes unless
+ * the kind is `READ`, and the received bytes unless the kind is `WRITE` or the transfer failed.
+ */
+struct ADS124S08::SPILog {
+	static constexpr std::array<Register, 7u> MAGIC		  = {'A', 'D', 'S', '1', '2', '4', 'L'};
+	static constexpr Register				  VERSION	  = 1u;
+	static constexpr std::size_t			  HEADER_SIZE = MAGIC.size() + 1u;
+
+	enum class Kind : Register {
+		READ	   = 0x00u, // `SPI::read()`
+		WRITE	   = 0x01u, // `SPI::write()`
+		READ_WRITE = 0x02u, // `SPI::readWrite()`
+	};
+	static constexpr Register FAILED = 0x80u; // Set in the kind byte of a failed transfer
+
+	/**
+	 * @brief Destination of the log bytes, as `CaptureWriter::Sink`.
+	 */
+	using Sink = CaptureWriter::Sink;
+};
+
+/**
+ * @brief `SPI` wrapper logging every transfer, with its outcome, for `ReplaySPI`.
+ *
+ * Each transfer is handed to the sink as one entry, so a log cut short, e.g. by a crash, ends
+ * on a complete transfer.
+ */
+class ADS124S08::RecordingSPI final : public SPI {
+public:
+	RecordingSPI(SPI &spi, SPILog::Sink sink, void *context) noexcept
+		: spi(spi), sink(sink), context(context) {}
+
+	/**
+	 * @brief Write the log header. Must be called before the first transfer.
+	 *
+	 * @return `true` if the sink accepted the header.
+	 */
+	bool begin(void) noexcept;
+
+	/**
+	 * @brief Check whether every entry so far reached the sink.
+	 */
+	bool failed(void) const noexcept { return failure; }
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override;
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept override;
+
+	std::optional<std::tuple<uint8_t, uint8_t>> readWrite(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count
+	) noexcept override;
+
+private:
+	SPI				  &spi;
+	const SPILog::Sink sink;
+	void *const		   context;
+	bool			   failure{false};
+
+	void log(
+		SPILog::Kind		  kind,
+		const Register *const txBuffer,
+		const Register *const rxBuffer,
+		uint8_t				  count,
+		const Register *const transferred
+	) noexcept;
+};
+
+/**
+ * @brief `SPI` replaying a log recorded by `RecordingSPI`, without any hardware or timing.
+ *
+ * Each transfer must match the next logged entry in kind, count and transmitted bytes; the
+ * logged received bytes and byte counts are then returned, and a logged failure fails the
+ * transfer. The driver, and whatever consumes its conversions, thus runs on field data as fast
+ * as it can process it. The first divergence is kept for inspection and fails every later
+ * transfer, as the driver no longer follows the recorded session.
+ *
+ * @note The log is not copied; it must outlive the transport. Map long logs into memory rather
+ * than reading them.
+ */
+class ADS124S08::ReplaySPI final : public SPI {
+public:
+	struct Mismatch {
+		std::size_t transfer; // Index of the diverging transfer
+		uint8_t		offset;	  // Transmitted byte that differs, or the count if the shape differs
+		Register	expected; // Logged byte, or the logged kind byte if the shape differs
+		Register	actual;
+	};
+
+	/**
+	 * @param log The log, header included.
+	 * @param size The number of bytes.
+	 */
+	ReplaySPI(const Register *const log, std::size_t size) noexcept;
+
+	/**
+	 * @brief Check whether the log header was valid.
+	 */
+	bool valid(void) const noexcept { return headerValid; }
+
+	/**
+	 * @brief Check whether every logged transfer was replayed.
+	 */
+	bool finished(void) const noexcept { return position >= size; }
+
+	std::size_t transferCount(void) const noexcept { return transfers; }
+
+	const std::optional<Mismatch> &mismatch(void) const noexcept { return divergence; }
+
+	/**
+	 * @brief Restart from the first logged transfer, clearing any mismatch, e.g. to loop a log.
+	 */
+	void rewind(void) noexcept;
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override;
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept override;
+
+	std::optional<std::tuple<uint8_t, uint8_t>> readWrite(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count
+	) noexcept override;
+
+private:
+	const Register *const log;
+	const std::size_t	  size;
+	const bool			  headerValid;
+
+	std::size_t				position;
+	std::size_t				transfers{0u};
+	std::optional<Mismatch> divergence{};
+
+	/**
+	 * @brief Consume the next entry if it matches the transfer.
+	 *
+	 * @param transferred Receives the logged byte counts, two for `READ_WRITE` and one otherwise.
+	 * @return `true` if the logged transfer succeeded, `false` on mismatch or logged failure.
+	 */
+	bool replay(
+		SPILog::Kind		  kind,
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count,
+		Register *const		  transferred
+	) noexcept;
+
+	void diverge(uint8_t offset, Register expected, Register actual) noexcept;
+};
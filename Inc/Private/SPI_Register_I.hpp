@@ -24,5 +24,7 @@ public:
 	virtual Register getResetValue(void) const = 0;
 
 protected:
-	virtual ~SPI_Register_I() = default;
+	// Non-virtual, as registers are never destroyed through this interface. This keeps the
+	// register structs literal types, so they may be declared `constexpr`.
+	~SPI_Register_I() = default;
 };
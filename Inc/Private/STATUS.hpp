@@ -1,24 +1,44 @@
 #pragma once
 
-struct ADS124S08::STATUS : SPI_Register_I {
+struct ADS124S08::STATUS final : SPI_Register_I {
 private:
-	static const Address  ADDRESS{0x01u};
-	static const Register RESET_VALUE{0x80u};
+	using FL_POR	 = RegisterField<7u, 1u>; // Power-On Reset Flag
+	using RDY		 = RegisterField<6u, 1u>; // Ready Flag
+	using FL_P_RAILP = RegisterField<5u, 1u>; // Positive PGA Output Positive Rail
+	using FL_P_RAILN = RegisterField<4u, 1u>; // Positive PGA Output Negative Rail
+	using FL_N_RAILP = RegisterField<3u, 1u>; // Negative PGA Output Positive Rail
+	using FL_N_RAILN = RegisterField<2u, 1u>; // Negative PGA Output Negative Rail
+	using FL_REF_L1	 = RegisterField<1u, 1u>; // Reference Voltage Monitor Level 1
+	using FL_REF_L0	 = RegisterField<0u, 1u>; // Reference Voltage Monitor Level 0
 
-	const Register FL_POR	  : 1; // Power-On Reset Flag
-	const Register RDY		  : 1; // Ready Flag
-	const Register FL_P_RAILP : 1; // Positive PGA Output Positive Rail
-	const Register FL_P_RAILN : 1; // Positive PGA Output Negative Rail
-	const Register FL_N_RAILP : 1; // Negative PGA Output Positive Rail
-	const Register FL_N_RAILN : 1; // Negative PGA Output Negative Rail
-	const Register FL_REF_L1  : 1; // Reference Voltage Monitor Level 1
-	const Register FL_REF_L0  : 1; // Reference Voltage Monitor Level 0
+public:
+	using Descriptor = RegisterDescriptor<
+		Address::STATUS,
+		0x80u,
+		FL_POR,
+		RDY,
+		FL_P_RAILP,
+		FL_P_RAILN,
+		FL_N_RAILP,
+		FL_N_RAILN,
+		FL_REF_L1,
+		FL_REF_L0>;
+
+private:
+	static constexpr Address  ADDRESS	  = Descriptor::address;
+	static constexpr Register RESET_VALUE = Descriptor::resetValue;
+
+	Register reg;
 
 public:
-	STATUS(Register val = STATUS::RESET_VALUE);
-	virtual ~STATUS() = default;
+	constexpr STATUS(Register val = STATUS::RESET_VALUE) : reg(val) {}
+
+	/**
+	 * @brief Get the register value as read, including the read-only flags.
+	 */
+	constexpr Register value(void) const noexcept { return reg; }
 
-	virtual Register toRegister(void) const override;
+	virtual Register toRegister(void) const override { return 0x00u; }
 
 	virtual Address	 getAddress(void) const override { return ADDRESS; }
 	virtual Register getResetValue(void) const override { return RESET_VALUE; }
@@ -50,14 +70,26 @@ public:
 		EXCEEDED	 = 0b0u, // More than Reference Voltage Monitor Threshold for Level
 	};
 
-	inline POR_Flag	  get_FL_POR(void) const { return static_cast<POR_Flag>(FL_POR); }
-	inline Dev_RDY	  get_RDY(void) const { return static_cast<Dev_RDY>(RDY); }
-	inline FL_RAIL	  get_FL_P_RAILP(void) const { return static_cast<FL_RAIL>(FL_P_RAILP); }
-	inline FL_RAIL	  get_FL_P_RAILN(void) const { return static_cast<FL_RAIL>(FL_P_RAILN); }
-	inline FL_RAIL	  get_FL_N_RAILP(void) const { return static_cast<FL_RAIL>(FL_N_RAILP); }
-	inline FL_RAIL	  get_FL_N_RAILN(void) const { return static_cast<FL_RAIL>(FL_N_RAILN); }
-	inline FL_REF_LVL get_FL_REF_L1(void) const { return static_cast<FL_REF_LVL>(FL_REF_L1); }
-	inline FL_REF_LVL get_FL_REF_L0(void) const { return static_cast<FL_REF_LVL>(FL_REF_L0); }
+	constexpr POR_Flag get_FL_POR(void) const { return static_cast<POR_Flag>(FL_POR::unpack(reg)); }
+	constexpr Dev_RDY  get_RDY(void) const { return static_cast<Dev_RDY>(RDY::unpack(reg)); }
+	constexpr FL_RAIL get_FL_P_RAILP(void) const {
+		return static_cast<FL_RAIL>(FL_P_RAILP::unpack(reg));
+	}
+	constexpr FL_RAIL get_FL_P_RAILN(void) const {
+		return static_cast<FL_RAIL>(FL_P_RAILN::unpack(reg));
+	}
+	constexpr FL_RAIL get_FL_N_RAILP(void) const {
+		return static_cast<FL_RAIL>(FL_N_RAILP::unpack(reg));
+	}
+	constexpr FL_RAIL get_FL_N_RAILN(void) const {
+		return static_cast<FL_RAIL>(FL_N_RAILN::unpack(reg));
+	}
+	constexpr FL_REF_LVL get_FL_REF_L1(void) const {
+		return static_cast<FL_REF_LVL>(FL_REF_L1::unpack(reg));
+	}
+	constexpr FL_REF_LVL get_FL_REF_L0(void) const {
+		return static_cast<FL_REF_LVL>(FL_REF_L0::unpack(reg));
+	}
 
 #ifdef ADS124S08_GTEST_TESTING
 	friend class STATUS_Test;
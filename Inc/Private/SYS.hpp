@@ -1,33 +1,35 @@
 #pragma once
 
-struct ADS124S08::SYS : SPI_Register_I {
+struct ADS124S08::SYS final : SPI_Register_I {
 private:
-	static const Address  ADDRESS{0x09u};
-	static const Register RESET_VALUE{0x10u};
+	using SYS_MON  = RegisterField<5u, 3u>;
+	using CAL_SAMP = RegisterField<3u, 2u>;
+	using TIMEOUT  = RegisterField<2u, 1u>;
+	using CRC_EN   = RegisterField<1u, 1u>; // Appended _EN to avoid conflict with #define CRC
+	using SENDSTAT = RegisterField<0u, 1u>;
 
-	Register SYS_MON  : 3;
-	Register CAL_SAMP : 2;
-	Register TIMEOUT  : 1;
-	Register CRC_EN	  : 1; // Appended _EN to avoid conflict with #define CRC in some environments
-	Register SENDSTAT : 1;
+public:
+	using Descriptor =
+		RegisterDescriptor<Address::SYS, 0x10u, SYS_MON, CAL_SAMP, TIMEOUT, CRC_EN, SENDSTAT>;
+
+private:
+	static constexpr Address  ADDRESS	  = Descriptor::address;
+	static constexpr Register RESET_VALUE = Descriptor::resetValue;
+
+	Register reg;
 
 public:
-	SYS(Register val = SYS::RESET_VALUE);
-	virtual ~SYS() = default;
+	constexpr SYS(Register val = SYS::RESET_VALUE) : reg(val) {}
 
 #ifdef ADS124S08_GTEST_TESTING
-	SYS(const std::array<Register, 5> &vals)
-		: SYS_MON(vals[0]),	 //
-		  CAL_SAMP(vals[1]), //
-		  TIMEOUT(vals[2]),	 //
-		  CRC_EN(vals[3]),	 //
-		  SENDSTAT(vals[4]) {}
+	constexpr SYS(const std::array<Register, 5> &vals)
+		: reg(Descriptor::pack(vals[0], vals[1], vals[2], vals[3], vals[4])) {}
 
 	FRIEND_TEST(SYS_Test, constructor_InitializesFieldsCorrectly_FromRegister);
 #endif
 
-	bool crc(void) const { return static_cast<bool>(CRC_EN); }
-	bool sendStat(void) const { return static_cast<bool>(SENDSTAT); }
+	constexpr bool crc(void) const { return CRC_EN::unpack(reg) != 0u; }
+	constexpr bool sendStat(void) const { return SENDSTAT::unpack(reg) != 0u; }
 
 	/**
 	 * @brief System Monitor Configuration
@@ -52,13 +54,41 @@ public:
 		AVG_16_SAMPLES = 0b11u, // 16 Samples
 	};
 
-	SYS &setSystemMonitorConfig(SystemMonitorConfig config);
-	SYS &setCalibrationSampleSize(CalSampleSize size);
-	SYS &setTimeout(bool enable);
-	SYS &setCRCEnable(bool enable);
-	SYS &setSendStatus(bool enable);
+	constexpr SYS &setSystemMonitorConfig(SystemMonitorConfig config) {
+		reg = SYS_MON::insert(reg, static_cast<Register>(config));
+		return *this;
+	}
+
+	constexpr SYS &setCalibrationSampleSize(CalSampleSize size) {
+		reg = CAL_SAMP::insert(reg, static_cast<Register>(size));
+		return *this;
+	}
+
+	constexpr CalSampleSize getCalibrationSampleSize(void) const {
+		return static_cast<CalSampleSize>(CAL_SAMP::unpack(reg));
+	}
+
+	constexpr SYS &setTimeout(bool enable) {
+		reg = TIMEOUT::insert(reg, enable ? 1u : 0u);
+		return *this;
+	}
+
+	constexpr SYS &setCRCEnable(bool enable) {
+		reg = CRC_EN::insert(reg, enable ? 1u : 0u);
+		return *this;
+	}
+
+	constexpr SYS &setSendStatus(bool enable) {
+		reg = SENDSTAT::insert(reg, enable ? 1u : 0u);
+		return *this;
+	}
+
+	/**
+	 * @brief Get the packed register value. Usable in constant expressions.
+	 */
+	constexpr Register value(void) const noexcept { return reg; }
 
-	virtual Register toRegister(void) const override;
+	virtual Register toRegister(void) const override { return value(); }
 
 	virtual Address	 getAddress(void) const override { return ADDRESS; }
 	virtual Register getResetValue(void) const override { return RESET_VALUE; }
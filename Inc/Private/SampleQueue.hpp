@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+
+/**
+ * @brief Fixed-capacity, lock-free single-producer/single-consumer queue of conversion results.
+ *
+ * One context (e.g. a DRDY interrupt or acquisition thread) may push while one other context
+ * pops. No allocation is performed and neither side ever blocks.
+ *
+ * @tparam CAPACITY The number of samples held. Must be a power of two.
+ */
+template <std::size_t CAPACITY> class ADS124S08::SampleQueue {
+	static_assert(CAPACITY >= 2u, "SampleQueue CAPACITY must be at least 2.");
+	static_assert((CAPACITY & (CAPACITY - 1u)) == 0u, "SampleQueue CAPACITY must be a power of 2.");
+
+private:
+	static constexpr std::size_t CACHE_LINE = 64u;
+	static constexpr std::size_t INDEX_MASK = CAPACITY - 1u;
+
+	// Producer owned line. `tailCache` avoids reading the consumer line on every push.
+	alignas(CACHE_LINE) std::atomic<std::size_t> head{0u};
+	std::size_t tailCache{0u};
+
+	// Consumer owned line. `headCache` avoids reading the producer line on every pop.
+	alignas(CACHE_LINE) std::atomic<std::size_t> tail{0u};
+	std::size_t headCache{0u};
+
+	alignas(CACHE_LINE) std::array<RDATA, CAPACITY> buffer{};
+
+public:
+	/**
+	 * @brief Append a sample. Producer side only.
+	 *
+	 * @param sample The conversion result to append.
+	 * @return `true` if queued, `false` if the queue was full.
+	 */
+	bool push(const RDATA &sample) noexcept {
+		const std::size_t index = head.load(std::memory_order_relaxed);
+
+		if (index - tailCache == CAPACITY) {
+			tailCache = tail.load(std::memory_order_acquire);
+			if (index - tailCache == CAPACITY) return false;
+		}
+
+		buffer[index & INDEX_MASK] = sample;
+		head.store(index + 1u, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief Remove the oldest sample. Consumer side only.
+	 *
+	 * @return The oldest sample, or `std::nullopt` if the queue was empty.
+	 */
+	std::optional<RDATA> pop(void) noexcept {
+		RDATA sample;
+		if (pop(&sample, 1u) == 1u) return sample;
+		else return std::nullopt;
+	}
+
+	/**
+	 * @brief Remove up to `count` of the oldest samples. Consumer side only.
+	 *
+	 * @param samples An array to store the removed samples.
+	 * @param count The maximum number of samples to remove.
+	 * @return The number of samples removed.
+	 */
+	std::size_t pop(RDATA *const samples, std::size_t count) noexcept {
+		const std::size_t index = tail.load(std::memory_order_relaxed);
+
+		if (headCache - index < count) headCache = head.load(std::memory_order_acquire);
+
+		const std::size_t available = headCache - index;
+		if (count > available) count = available;
+
+		for (std::size_t i = 0u; i < count; i++) {
+			samples[i] = buffer[(index + i) & INDEX_MASK];
+		}
+
+		tail.store(index + count, std::memory_order_release);
+		return count;
+	}
+
+	/**
+	 * @brief Get the number of queued samples.
+	 *
+	 * @note Only a snapshot when called concurrently with push or pop.
+	 */
+	std::size_t size(void) const noexcept {
+		const std::size_t t = tail.load(std::memory_order_acquire);
+		return head.load(std::memory_order_acquire) - t;
+	}
+
+	bool empty(void) const noexcept { return size() == 0u; }
+
+	static constexpr std::size_t capacity(void) noexcept { return CAPACITY; }
+};
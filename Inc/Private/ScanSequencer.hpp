@@ -0,0 +1,255 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * @brief Configuration of one channel of a multi-channel scan.
+ *
+ * @note The four registers are contiguous (02h to 05h), so any change between channels is sent
+ * as a single WREG.
+ * @note Channels are literal types, so channel tables may be declared `static constexpr` and
+ * placed in read-only memory.
+ */
+struct ADS124S08::ScanChannel {
+	INPMUX	 inpmux{};
+	PGA		 pga{};
+	DATARATE datarate{};
+	REF		 ref{};
+};
+
+/**
+ * @brief Multi-channel scan sequencer.
+ *
+ * Cycles through a list of channel configurations, collecting one conversion per channel per
+ * cycle. Only the registers differing from the previous channel are written, and the channels
+ * are visited in the order that minimises the WREG bytes sent per cycle. Results are always
+ * reported in the caller's channel order.
+ *
+ * @tparam MAX_CHANNELS The maximum number of channels. No memory is allocated.
+ */
+template <std::size_t MAX_CHANNELS> class ADS124S08::ScanSequencer {
+	static_assert(
+		MAX_CHANNELS > 0u && MAX_CHANNELS <= 256u, "ScanSequencer supports 1 to 256 channels"
+	);
+
+public:
+	using Image = std::array<Register, 4u>; // INPMUX, PGA, DATARATE, REF
+
+private:
+	ADS124S08						 &adc;
+	const ScanChannel				 *channels;
+	const std::size_t				  count;
+	const DataReadMode				  mode;
+	std::array<uint8_t, MAX_CHANNELS> order{};
+
+	static constexpr Image imageOf(const ScanChannel &channel) noexcept {
+		return Image{
+			channel.inpmux.value(),
+			channel.pga.value(),
+			channel.datarate.value(),
+			channel.ref.value(),
+		};
+	}
+
+	// Best cyclic nearest-neighbour tour, trying every channel as the starting point
+	void reorder(void) noexcept {
+		std::array<Image, MAX_CHANNELS> images{};
+		for (std::size_t i = 0u; i < count; i++) {
+			images[i] = imageOf(channels[i]);
+		}
+
+		uint32_t bestCost = UINT32_MAX;
+		for (std::size_t first = 0u; first < count; first++) {
+			std::array<uint8_t, MAX_CHANNELS> tour{};
+			std::array<bool, MAX_CHANNELS>	  visited{};
+
+			tour[0]		   = static_cast<uint8_t>(first);
+			visited[first] = true;
+			uint32_t cost  = 0u;
+
+			for (std::size_t step = 1u; step < count; step++) {
+				const Image &from = images[tour[step - 1u]];
+
+				std::size_t nearest		= 0u;
+				uint32_t	nearestCost = UINT32_MAX;
+				for (std::size_t candidate = 0u; candidate < count; candidate++) {
+					if (visited[candidate]) continue;
+					const uint32_t candidateCost = transitionCost(from, images[candidate]);
+					if (candidateCost < nearestCost) {
+						nearest		= candidate;
+						nearestCost = candidateCost;
+					}
+				}
+
+				tour[step]		 = static_cast<uint8_t>(nearest);
+				visited[nearest] = true;
+				cost += nearestCost;
+			}
+			cost += transitionCost(images[tour[count - 1u]], images[tour[0]]);
+
+			if (cost < bestCost) {
+				bestCost = cost;
+				order	 = tour;
+			}
+		}
+	}
+
+public:
+	/**
+	 * @brief Construct a sequencer over a caller-owned array of channels.
+	 *
+	 * @param adc The ADS124S08 to scan.
+	 * @param channels The channel configurations. Must outlive the sequencer.
+	 * @param count The number of channels. Limited to `MAX_CHANNELS`.
+	 * @param mode The conversion read method.
+	 * @param optimiseOrder Reorder the channels to minimise register writes. If `false`, the
+	 * channels are scanned in the given order.
+	 */
+	ScanSequencer(
+		ADS124S08		  &adc,
+		const ScanChannel *channels,
+		std::size_t		   count,
+		DataReadMode	   mode			 = DataReadMode::COMMAND,
+		bool			   optimiseOrder = true
+	) noexcept
+		: adc(adc),
+		  channels(channels),
+		  count(channels == nullptr ? 0u : std::min(count, MAX_CHANNELS)),
+		  mode(mode) {
+		for (std::size_t i = 0u; i < this->count; i++) {
+			order[i] = static_cast<uint8_t>(i);
+		}
+		if (optimiseOrder && this->count > 2u) reorder();
+	}
+
+	/**
+	 * @brief Get the WREG bytes needed to change from one channel configuration to another.
+	 *
+	 * @return The command, count and data bytes of the single WREG, or 0 if nothing differs.
+	 */
+	static uint32_t transitionCost(const Image &from, const Image &to) noexcept {
+		std::size_t first = to.size();
+		std::size_t last  = 0u;
+		for (std::size_t i = 0u; i < to.size(); i++) {
+			if (from[i] != to[i]) {
+				if (first == to.size()) first = i;
+				last = i;
+			}
+		}
+		return first == to.size() ? 0u : static_cast<uint32_t>(2u + last - first + 1u);
+	}
+
+	/**
+	 * @brief Get the WREG bytes sent per cycle in the current scan order.
+	 */
+	uint32_t cycleCost(void) const noexcept {
+		uint32_t cost = 0u;
+		for (std::size_t i = 0u; i < count; i++) {
+			cost += transitionCost(
+				imageOf(channels[order[i]]), //
+				imageOf(channels[order[(i + 1u) % count]])
+			);
+		}
+		return cost;
+	}
+
+	/**
+	 * @brief Estimate the duration of one scan cycle in the current scan order.
+	 *
+	 * A channel whose registers change, or that uses single-shot mode, waits the full
+	 * `LatencyModel` first-sample latency; otherwise the conversion period.
+	 *
+	 * @return The cycle time in t_MOD, excluding SPI transfer time.
+	 */
+	uint32_t cycleTime(void) const noexcept {
+		uint32_t time = 0u;
+		for (std::size_t i = 0u; i < count; i++) {
+			const ScanChannel &previous = channels[order[(i + count - 1u) % count]];
+			const ScanChannel &channel	= channels[order[i]];
+
+			const auto latency	  = LatencyModel::compute(channel.pga, channel.datarate);
+			const bool restarted = transitionCost(imageOf(previous), imageOf(channel)) != 0u ||
+								   channel.datarate.getConversionMode() ==
+									   DATARATE::ModeSelect::SINGLE_SHOT;
+			time += restarted ? latency.firstSample : latency.period;
+		}
+		return time;
+	}
+
+	std::size_t size(void) const noexcept { return count; }
+
+	/**
+	 * @brief Get the index of the channel visited at a position in the scan.
+	 */
+	std::size_t channelAt(std::size_t position) const noexcept { return order[position]; }
+
+	/**
+	 * @brief Perform one scan cycle.
+	 *
+	 * For each channel the configuration is written, a conversion is awaited and then read.
+	 * Writing the configuration restarts the conversion in progress, so the result is settled.
+	 * START is sent for channels configured for single-shot conversion.
+	 *
+	 * @param results An array of `size()` results, indexed in the caller's channel order. A
+	 * failed channel is set to `std::nullopt`.
+	 * @param waitReady Called before each read to wait for DRDY. If it returns `false` the
+	 * channel is failed. Required, as a conversion read straight after the configuration is
+	 * still that of the previous channel.
+	 * @param context Passed to `waitReady`.
+	 * @return The number of channels read successfully.
+	 */
+	std::size_t scan(
+		std::optional<RDATA> *const results,
+		WaitReady					waitReady,
+		void					   *context = nullptr
+	) noexcept {
+		if (results == nullptr || waitReady == nullptr) return 0u;
+
+		std::size_t successes = 0u;
+		for (std::size_t position = 0u; position < count; position++) {
+			const std::size_t  index   = order[position];
+			const ScanChannel &channel = channels[index];
+			results[index]			   = std::nullopt;
+
+			if (!adc.setRegisters({channel.inpmux, channel.pga, channel.datarate, channel.ref})) {
+				continue;
+			}
+
+			if (channel.datarate.getConversionMode() == DATARATE::ModeSelect::SINGLE_SHOT) {
+				if (!adc.start()) continue;
+			}
+
+			if (!waitReady(context)) continue;
+
+			results[index] = adc.rdata(mode);
+			if (results[index]) successes++;
+		}
+		return successes;
+	}
+
+	/**
+	 * @brief Perform several scan cycles.
+	 *
+	 * @param results An array of `cycles * size()` results. Cycle `c` is stored from
+	 * `results[c * size()]`.
+	 * @param cycles The number of cycles.
+	 * @param waitReady Called before each read to wait for DRDY, as in `scan()`.
+	 * @param context Passed to `waitReady`.
+	 * @return The number of channels read successfully over all cycles.
+	 */
+	std::size_t run(
+		std::optional<RDATA> *const results,
+		std::size_t					cycles,
+		WaitReady					waitReady,
+		void					   *context = nullptr
+	) noexcept {
+		if (results == nullptr || waitReady == nullptr) return 0u;
+
+		std::size_t successes = 0u;
+		for (std::size_t cycle = 0u; cycle < cycles; cycle++) {
+			successes += scan(&results[cycle * count], waitReady, context);
+		}
+		return successes;
+	}
+};
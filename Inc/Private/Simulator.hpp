@@ -0,0 +1,148 @@
+#pragma once
+
+/**
+ * @brief Behavioral model of an ADS124S08 behind the `SPI` interface.
+ *
+ * Decodes the commands, RREG, WREG and conversion reads of each transfer against a register
+ * file, and produces conversions on a simulated clock at the configured data rate. The first
+ * conversion after START, or after a WREG to a configuration register while converting, is
+ * delayed by the `LatencyModel` first-sample latency; the SINC3 filter output averages the
+ * input over its settling periods. Conversion frames carry the STATUS and CRC bytes enabled in
+ * SYS, and the calibration commands update OFCAL and FSCAL.
+ *
+ * Time only moves with `advance()`, and with each byte transferred if an SPI clock is set, so
+ * runs are deterministic and independent of the host.
+ *
+ * @note Each transfer is one chip select assertion; several commands may follow each other in
+ * a transfer.
+ */
+class ADS124S08::Simulator final : public SPI {
+public:
+	/**
+	 * @brief Analog input of the simulated device.
+	 *
+	 * @param context The user context given to `setInput()`.
+	 * @param inpmux The INPMUX register value selecting the inputs.
+	 * @param nanoseconds The simulated time.
+	 * @return The differential input voltage in volts.
+	 */
+	using Input = float (*)(void *context, Register inpmux, uint64_t nanoseconds) noexcept;
+
+	/**
+	 * @brief Called when a conversion completes, i.e. on the DRDY falling edge.
+	 */
+	using DataReadyCallback = void (*)(void *context) noexcept;
+
+	struct Configuration {
+		Register id;			 // ID register value
+		float	 referenceVolts; // Reference voltage
+		float	 offsetVolts;	 // Input-referred offset, removed by offset calibration
+		uint32_t clockHz;		 // Device clock frequency
+		uint32_t sclkHz;		 // SPI clock. 0 for transfers taking no simulated time
+
+		static constexpr Configuration defaults(void) noexcept {
+			return {0x00u, 2.5f, 0.0f, LatencyModel::INTERNAL_CLOCK_HZ, 0u};
+		}
+	};
+
+	struct Statistics {
+		uint32_t transfers;	  // SPI transfers, i.e. chip select assertions
+		uint32_t bytes;		  // Bytes transferred
+		uint32_t conversions; // Conversions completed
+		uint32_t overruns;	  // Conversions overwritten before being read
+	};
+
+	explicit Simulator(const Configuration &configuration = Configuration::defaults()) noexcept;
+
+	/**
+	 * @brief Set the analog input. Without one, the input is shorted (0 V).
+	 */
+	void setInput(Input input, void *context = nullptr) noexcept;
+
+	void setDataReadyCallback(DataReadyCallback callback, void *context = nullptr) noexcept;
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override;
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept override;
+
+	std::optional<std::tuple<uint8_t, uint8_t>> readWrite(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count
+	) noexcept override;
+
+	/**
+	 * @brief Advance the simulated time, completing the conversions that fall due.
+	 */
+	void advance(uint64_t nanoseconds) noexcept;
+
+	/**
+	 * @brief Advance the simulated time to the next conversion or calibration event.
+	 *
+	 * @return `true` if an event was pending, `false` if the device is idle.
+	 */
+	bool advanceToNextEvent(void) noexcept;
+
+	uint64_t now(void) const noexcept { return time; }
+
+	/**
+	 * @brief Get the DRDY state.
+	 *
+	 * @return `true` (pin low) while a completed conversion has not been read.
+	 */
+	bool dataReady(void) const noexcept { return newData; }
+
+	bool converting(void) const noexcept { return running; }
+
+	Register registerValue(Address address) const noexcept { return registers[address]; }
+
+	/**
+	 * @brief Get the latest conversion result as a signed 24-bit code.
+	 */
+	int32_t latestCode(void) const noexcept { return latest; }
+
+	const Statistics &getStatistics(void) const noexcept { return statistics; }
+
+private:
+	const Configuration configuration;
+
+	std::array<Register, REGISTER_COUNT> registers;
+
+	Input			  input{nullptr};
+	void			 *inputContext{nullptr};
+	DataReadyCallback dataReadyCallback{nullptr};
+	void			 *dataReadyContext{nullptr};
+
+	uint64_t time{0u};
+	bool	 running{false};	 // Conversions in progress
+	bool	 continuous{false};	 // Another conversion follows the pending one
+	uint64_t nextConversion{0u}; // Completion time of the pending conversion
+
+	bool	 calibrating{false};
+	Command	 calibration{0u};
+	uint64_t calibrationEnd{0u};
+	bool	 resumeConversions{false}; // Restart the conversions once calibrated
+
+	int32_t	   latest{0};
+	bool	   newData{false};
+	Statistics statistics{};
+
+	void	 reset(void) noexcept;
+	void	 restart(void) noexcept;
+	void	 startCalibration(Command command) noexcept;
+	void	 completeConversion(void) noexcept;
+	void	 completeCalibration(void) noexcept;
+	uint64_t nextEvent(void) const noexcept;
+
+	void elapse(uint8_t bytes) noexcept;
+	void writeRegisters(Address startAddress, const Register *values, uint8_t count) noexcept;
+
+	LatencyModel::Latency latency(void) const noexcept;
+	float				  sample(uint64_t nanoseconds) const noexcept;
+	int32_t				  measure(uint64_t nanoseconds, bool shorted) const noexcept;
+	int32_t				  calibrated(int32_t code) const noexcept;
+
+	// Transfer decoding: each returns the bytes consumed from `index`
+	uint8_t transfer(const Register *tx, Register *rx, uint8_t count) noexcept;
+	uint8_t command(const Register *tx, Register *rx, uint8_t index, uint8_t count) noexcept;
+	uint8_t conversionFrame(Register *rx, uint8_t index, uint8_t count) noexcept;
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <linux/spi/spidev.h>
+
+/**
+ * @brief SPI transport for Linux `/dev/spidevX.Y`.
+ *
+ * Every transfer is submitted with `SPI_IOC_MESSAGE`, one system call per message. Between
+ * `beginBatch()` and `flush()`, writes are queued instead and sent in the same message as the
+ * next read, or at `flush()`, with the chip select released between segments. A configuration
+ * sequence such as several WREGs and START followed by the first RDATA then costs a single
+ * kernel crossing.
+ *
+ * @note The file descriptor is not owned; close it after the transport is destroyed.
+ */
+class ADS124S08::SpidevSPI final : public SPI {
+public:
+	static constexpr uint8_t	 MAX_SEGMENTS = 16u;  // Segments per message
+	static constexpr std::size_t BUFFER_SIZE  = 256u; // Queued transmit bytes
+
+	/**
+	 * @brief The `ioctl()` used to reach the device. Replaceable to simulate a spidev.
+	 */
+	using Ioctl = int (*)(int fd, unsigned long request, void *argument) noexcept;
+
+	/**
+	 * @brief One segment of a message: a full-duplex transfer within one chip select assertion.
+	 */
+	struct Segment {
+		const Register *txBuffer; // `nullptr` to clock out NOPs
+		Register	   *rxBuffer; // `nullptr` to discard the bytes clocked in
+		uint8_t			count;
+	};
+
+	/**
+	 * @brief Open a spidev and configure it for the ADS124S08: SPI mode 1, 8-bit words.
+	 *
+	 * @param path The device, e.g. `/dev/spidev0.0`.
+	 * @param speedHz The maximum clock frequency.
+	 * @param ioctl The `ioctl()` used for configuration.
+	 * @return The file descriptor, or -1 on failure.
+	 */
+	static int open(const char *path, uint32_t speedHz, Ioctl ioctl = systemIoctl) noexcept;
+
+	/**
+	 * @param fd An open spidev file descriptor.
+	 * @param speedHz Clock frequency of each transfer, or 0 for the device default.
+	 * @param ioctl The `ioctl()` used to submit messages.
+	 */
+	explicit SpidevSPI(int fd, uint32_t speedHz = 0u, Ioctl ioctl = systemIoctl) noexcept
+		: fd(fd), speedHz(speedHz), ioctl(ioctl) {}
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override;
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept override;
+
+	std::optional<std::tuple<uint8_t, uint8_t>> readWrite(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count
+	) noexcept override;
+
+	/**
+	 * @brief Send several segments as one message.
+	 *
+	 * @param segments The segments, at most `MAX_SEGMENTS`.
+	 * @param count The number of segments.
+	 * @return `true` if the message was transferred, `false` otherwise.
+	 * @note Segments already queued by a batch are sent first, in the same message if they fit.
+	 */
+	bool transfer(const Segment *const segments, uint8_t count) noexcept;
+
+	/**
+	 * @brief Queue subsequent writes until the next read or `flush()`.
+	 *
+	 * Queued writes are reported as successful, so the driver caches the registers they write.
+	 * If the message sending them fails, the register cache of `adc` is invalidated, and the
+	 * registers are read back from the device on their next access.
+	 *
+	 * @param adc The driver issuing the writes.
+	 */
+	void beginBatch(const ADS124S08 &adc) noexcept {
+		batching = true;
+		driver	 = &adc;
+	}
+
+	/**
+	 * @brief Send the queued writes and end the batch.
+	 *
+	 * @return `true` if the queued writes were transferred or none were queued.
+	 */
+	bool flush(void) noexcept;
+
+	/**
+	 * @brief Get the number of messages submitted, i.e. of `SPI_IOC_MESSAGE` system calls.
+	 */
+	uint32_t messageCount(void) const noexcept { return messages; }
+
+	static int systemIoctl(int fd, unsigned long request, void *argument) noexcept;
+
+private:
+	const int	   fd;
+	const uint32_t speedHz;
+	const Ioctl	   ioctl;
+
+	bool			 batching{false};
+	bool			 deferred{false}; // Queued writes were reported as successful
+	const ADS124S08 *driver{nullptr};
+	uint32_t		 messages{0u};
+
+	std::array<spi_ioc_transfer, MAX_SEGMENTS> queue{};
+	uint8_t									   queued{0u};
+	std::array<Register, BUFFER_SIZE>		   txStorage{}; // Copies of queued write data
+	std::size_t								   txUsed{0u};
+
+	bool enqueue(const Register *txBuffer, Register *rxBuffer, uint8_t count, bool copy) noexcept;
+	bool submit(void) noexcept;
+};
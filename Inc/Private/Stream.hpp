@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * @brief Continuous-conversion streaming engine.
+ *
+ * Decouples acquisition from processing: the producer context calls `onDataReady()` once per
+ * DRDY, which reads the conversion and pushes it into a lock-free queue, while a consumer
+ * context drains `samples()` at its own pace.
+ *
+ * @tparam CAPACITY The number of samples buffered. Must be a power of two.
+ */
+template <std::size_t CAPACITY> class ADS124S08::Stream {
+public:
+	struct Statistics {
+		uint32_t samples;	   // Conversions read and queued
+		uint32_t overruns;	   // Conversions read but dropped as the queue was full
+		uint32_t readFailures; // Conversions lost to SPI failures
+	};
+
+private:
+	ADS124S08			 &adc;
+	const DataReadMode	  mode;
+	SampleQueue<CAPACITY> queue{};
+
+	// Written by the producer only, readable from the consumer
+	std::atomic<uint32_t> sampleCount{0u};
+	std::atomic<uint32_t> overrunCount{0u};
+	std::atomic<uint32_t> readFailureCount{0u};
+
+	static void increment(std::atomic<uint32_t> &counter) noexcept {
+		counter.store(counter.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+	}
+
+public:
+	/**
+	 * @brief Construct a stream over a configured ADS124S08.
+	 *
+	 * @param adc The ADS124S08 to acquire from.
+	 * @param mode The conversion read method. `DataReadMode::DIRECT` halves the SPI calls per
+	 * sample, but requires every read to complete before the following DRDY.
+	 */
+	explicit Stream(ADS124S08 &adc, DataReadMode mode = DataReadMode::COMMAND) noexcept
+		: adc(adc), mode(mode) {}
+
+	/**
+	 * @brief Send START to begin continuous conversions.
+	 *
+	 * @return The command sent if successful, `std::nullopt` otherwise.
+	 * @note The DATARATE register should be configured for continuous conversion mode.
+	 */
+	std::optional<Register> start(void) noexcept { return adc.start(); }
+
+	/**
+	 * @brief Send STOP to end conversions.
+	 *
+	 * @return The command sent if successful, `std::nullopt` otherwise.
+	 */
+	std::optional<Register> stop(void) noexcept { return adc.stop(); }
+
+	/**
+	 * @brief Read the latest conversion and queue it. Producer side only.
+	 *
+	 * @return `true` if a sample was queued, `false` if the read failed or the queue was full.
+	 * @note Call once per DRDY falling edge. The conversion is always read, even when the
+	 * queue is full, so that the device keeps pace.
+	 */
+	bool onDataReady(void) noexcept {
+		const auto sample = adc.rdata(mode);
+		if (!sample) {
+			increment(readFailureCount);
+			return false;
+		}
+
+		if (!queue.push(*sample)) {
+			increment(overrunCount);
+			return false;
+		}
+
+		increment(sampleCount);
+		return true;
+	}
+
+	/**
+	 * @brief Access the queue of acquired samples. Consumer side only.
+	 */
+	SampleQueue<CAPACITY> &samples(void) noexcept { return queue; }
+
+	Statistics getStatistics(void) const noexcept {
+		return Statistics{
+			sampleCount.load(std::memory_order_relaxed),
+			overrunCount.load(std::memory_order_relaxed),
+			readFailureCount.load(std::memory_order_relaxed),
+		};
+	}
+};
@@ -8,72 +8,39 @@ using Register		 = ADS124S08::SPI::Register;
 using Command		 = ADS124S08::SPI::Command;
 using ControlCommand = ADS124S08::SPI::ControlCommand;
 
-ADS124S08::ADS124S08(SPI &spi) : spi(spi) {
-	getSystemControl();
-}
-
 static constexpr Address ADS124S08_MAX_REGISTER_ADDRESS = static_cast<Address>(0x11u);
-static constexpr uint8_t ADS124S08_MAX_REGISTER_COUNT	= 18u;
+static constexpr uint8_t ADS124S08_MAX_REGISTER_COUNT	= ADS124S08::REGISTER_COUNT;
 
-static constexpr bool
-validateAddressRange(const ADS124S08::SPI::Address startAddress, const uint8_t count) noexcept {
-	if (count < 1u || count > ADS124S08_MAX_REGISTER_COUNT) return false;
-	if (startAddress + count > ADS124S08_MAX_REGISTER_ADDRESS + 1) return false;
-	return true;
+static constexpr uint32_t registerMask(const Address startAddress, const uint8_t count) noexcept {
+	return ((1ul << count) - 1ul) << startAddress;
 }
 
-std::optional<ADS124S08::Register> ADS124S08::rreg(
-	const ADS124S08::SPI::Address startAddress,
-	const uint8_t				  count,
-	SPI::Register *const		  buffer
-) const noexcept {
-	// Range checks
-	if (!validateAddressRange(startAddress, count)) return std::nullopt;
-
-	// Nullptr check for single register read
-	if (buffer == nullptr) {
-		if (count != 1u) return std::nullopt;
-	}
+// Registers whose contents may change without a WREG, and so are never trusted from the cache.
+static constexpr uint32_t ADS124S08_VOLATILE_REGISTERS =
+	registerMask(Address::ID, 1u) | registerMask(Address::STATUS, 1u) |
+	registerMask(Address::GPIO_DATA, 1u);
 
-	std::array<uint8_t, 2> mosi = {
-		(uint8_t)(0x20u | startAddress), // RREG command
-		(uint8_t)(count - 1u),			 // Number of registers to read minus one
-	};
+// Registers overwritten by the calibration commands.
+static constexpr uint32_t ADS124S08_CALIBRATION_REGISTERS = registerMask(Address::OF_CAL0, 6u);
 
-	Register		reg0 = 0;
-	Register *const miso = (buffer != nullptr) ? buffer : &reg0;
-
-	const auto writeResult = spi.write(mosi.data(), mosi.size());
+ADS124S08::ADS124S08(SPI &spi) : spi(spi), registerCache(RESET_VALUES) {
+	refreshRegisterCache();
+}
 
-	if (writeResult) {
-		const auto readResult = spi.read(miso, count);
-		if (readResult) { return miso[0]; }
-	}
-	return std::nullopt;
+std::optional<ADS124S08::Register> ADS124S08::rreg(
+	const Address		 startAddress,
+	const uint8_t		 count,
+	SPI::Register *const buffer
+) const noexcept {
+	return rregVia(spi, startAddress, count, buffer);
 }
 
 std::optional<ADS124S08::Register> ADS124S08::wreg(
-	const ADS124S08::SPI::Address startAddress,
-	const uint8_t				  count,
-	const SPI::Register *const	  buffer
+	const Address			   startAddress,
+	const uint8_t			   count,
+	const SPI::Register *const buffer
 ) const noexcept {
-	// Range checks
-	if (count > ADS124S08_MAX_REGISTER_COUNT) return std::nullopt;
-	if (!validateAddressRange(startAddress, count)) return std::nullopt;
-	if (buffer == nullptr) return std::nullopt;
-
-	// Allocating excess to maintain STATIC stack usage
-	Register mosi[2 + ADS124S08_MAX_REGISTER_COUNT];
-
-	mosi[0] = (uint8_t)(0x40u | startAddress); // WREG command
-	mosi[1] = (uint8_t)(count - 1u);		   // Number of registers to write minus one
-	std::copy_n(buffer, count, &mosi[2]);
-
-	const auto writeResult = spi.write(mosi, 2u + count);
-
-	if (writeResult) {
-		return mosi[2];
-	} else return std::nullopt;
+	return wregVia(spi, startAddress, count, buffer);
 }
 
 std::optional<ADS124S08::Register> ADS124S08::wreg(
@@ -85,98 +52,219 @@ std::optional<ADS124S08::Register> ADS124S08::wreg(
 
 std::optional<ADS124S08::RDATA>
 ADS124S08::rdata(std::optional<bool> statusEnabled, std::optional<bool> crcEnabled) const noexcept {
-	uint8_t byteCount = 3u; // Data bytes
+	return rdataVia(spi, DataReadMode::COMMAND, statusEnabled, crcEnabled);
+}
 
-	bool statusByte =
-		statusEnabled.value_or(SYS(sysCache).sendStat());	 // Default to cached SYS register value
-	bool crcByte = crcEnabled.value_or(SYS(sysCache).crc()); // Default to cached SYS register value
+std::optional<ADS124S08::RDATA> ADS124S08::rdataDirect(
+	std::optional<bool> statusEnabled, //
+	std::optional<bool> crcEnabled
+) const noexcept {
+	return rdataVia(spi, DataReadMode::DIRECT, statusEnabled, crcEnabled);
+}
 
-	if (statusByte) byteCount += 1u;
-	if (crcByte) byteCount += 1u;
+std::size_t ADS124S08::rdataBatch(
+	const RDATABatch &batch,
+	std::size_t		  count,
+	DataReadMode	  mode,
+	WaitReady		  waitReady,
+	void			 *context
+) const noexcept {
+	return rdataBatchVia(spi, batch, count, mode, waitReady, context);
+}
 
-	Register misoBuffer[5u] = {0}; // Max 5 bytes (STATUS + 3 data + CRC)
+std::optional<ADS124S08::SYS> ADS124S08::getSystemControl(void) noexcept {
+	// rreg updates the cached value
+	auto sysReg = rreg(SPI::Address::SYS, 1u);
+	if (sysReg) return SYS(*sysReg);
+	else return std::nullopt;
+}
 
-	Register mosiBuffer[1u] = {
-		static_cast<Register>(SPI::DataReadCommand::RDATA),
-	};
+std::optional<ADS124S08::Register> ADS124S08::setSystemControl(const SYS &sysReg) noexcept {
+	// wreg updates the cached value
+	return setRegister(sysReg);
+}
 
-	auto writeResult = spi.write(mosiBuffer, sizeof(mosiBuffer));
-	if (!writeResult) return std::nullopt;
+static bool stageRegister(
+	std::array<Register, ADS124S08_MAX_REGISTER_COUNT> &image,
+	uint32_t										   &dirty,
+	const ADS124S08::SPI_Register_I					   &reg
+) noexcept {
+	const Address address = reg.getAddress();
+	if (address > ADS124S08_MAX_REGISTER_ADDRESS) return false;
 
-	auto readResult = spi.read(misoBuffer, byteCount);
-	if (!readResult) return std::nullopt;
+	image[address] = reg.toRegister();
+	dirty |= registerMask(address, 1u);
+	return true;
+}
 
-	RDATA result;
+std::optional<uint8_t> ADS124S08::setRegisters(
+	const SPI_Register_I *const *const regs, //
+	const uint8_t					   count
+) const noexcept {
+	if (regs == nullptr) return std::nullopt;
 
-	uint8_t index = 0u;
-	if (statusByte) result.status = misoBuffer[index++];
-	else result.status = std::nullopt;
+	std::array<Register, ADS124S08_MAX_REGISTER_COUNT> image = registerCache;
+	uint32_t										   dirty = 0u;
 
-	result.data = 0u;
-	for (uint8_t i = index; i < index + 3u; i++) {
-		result.data = (result.data << 8u) | misoBuffer[i];
+	for (uint8_t i = 0u; i < count; i++) {
+		if (regs[i] == nullptr) return std::nullopt;
+		if (!stageRegister(image, dirty, *regs[i])) return std::nullopt;
 	}
-	index += 3u;
 
-	if (crcByte) result.crc = misoBuffer[index++];
-	else result.crc = std::nullopt;
+	return writeStagedRegisters(image, dirty);
+}
 
-	return result;
+std::optional<uint8_t> ADS124S08::setRegisters(
+	std::initializer_list<std::reference_wrapper<const SPI_Register_I>> regs
+) const noexcept {
+	std::array<Register, ADS124S08_MAX_REGISTER_COUNT> image = registerCache;
+	uint32_t										   dirty = 0u;
+
+	for (const SPI_Register_I &reg : regs) {
+		if (!stageRegister(image, dirty, reg)) return std::nullopt;
+	}
+
+	return writeStagedRegisters(image, dirty);
 }
 
-std::optional<ADS124S08::SYS> ADS124S08::getSystemControl(void) noexcept {
-	auto sysReg = rreg(SPI::Address::SYS, 1u);
-	if (sysReg) {
-		sysCache = *sysReg;
-		return SYS(*sysReg);
-	} else return std::nullopt;
+std::optional<uint8_t> ADS124S08::writeStagedRegisters(
+	const std::array<Register, ADS124S08_MAX_REGISTER_COUNT> &image,
+	uint32_t												  dirty
+) const noexcept {
+	// Drop registers the device is already known to hold
+	for (uint8_t address = 0u; address < ADS124S08_MAX_REGISTER_COUNT; address++) {
+		const uint32_t bit	 = registerMask(static_cast<Address>(address), 1u);
+		const bool	   known = (registerCacheValid & bit) != 0u;
+		if ((dirty & bit) && known && registerCache[address] == image[address]) {
+			dirty &= ~bit;
+			writeStatistics.elidedBytes++;
+		}
+	}
+
+	if (dirty == 0u) {
+		writeStatistics.elidedWrites++;
+		return 0u;
+	}
+
+	uint8_t bursts	= 0u;
+	uint8_t address = 0u;
+	while (address < ADS124S08_MAX_REGISTER_COUNT) {
+		if (!(dirty & registerMask(static_cast<Address>(address), 1u))) {
+			address++;
+			continue;
+		}
+
+		// Extend the burst to the next dirty register while every register in between is known
+		const uint8_t start = address;
+		uint8_t		  end	= address + 1u;
+		for (uint8_t next = end; next < ADS124S08_MAX_REGISTER_COUNT; next++) {
+			const uint32_t bit = registerMask(static_cast<Address>(next), 1u);
+			if (dirty & bit) end = next + 1u;
+			else if (!(registerCacheValid & bit)) break;
+		}
+
+		if (!wreg(static_cast<Address>(start), end - start, &image[start])) return std::nullopt;
+
+		bursts++;
+		address = end;
+	}
+
+	return bursts;
 }
 
-std::optional<ADS124S08::Register> ADS124S08::setSystemControl(const SYS &sysReg) noexcept {
-	auto writeResult = setRegister(sysReg);
-	if (writeResult) {
-		sysCache = *writeResult;
-		return writeResult;
-	} else return std::nullopt;
+std::optional<ADS124S08::Register> ADS124S08::refreshRegisterCache(void) noexcept {
+	Register buffer[ADS124S08_MAX_REGISTER_COUNT];
+	return rreg(Address::ID, ADS124S08_MAX_REGISTER_COUNT, buffer);
 }
 
-static std::optional<Register>
-writeSingleByteCommand(ADS124S08::SPI &spi, Command command) noexcept {
-	const auto writeResult = spi.write(&command, 1u);
-	if (writeResult) return command;
+void ADS124S08::invalidateRegisterCache(void) noexcept {
+	registerCacheValid = 0u;
+}
+
+std::optional<ADS124S08::Register> ADS124S08::getCachedRegister(Address address) const noexcept {
+	if (address > ADS124S08_MAX_REGISTER_ADDRESS) return std::nullopt;
+	if (registerCacheValid & (1ul << address)) return registerCache[address];
 	else return std::nullopt;
 }
 
+void ADS124S08::invalidateCachedRange(Address startAddress, uint8_t count) const noexcept {
+	registerCacheValid &= ~registerMask(startAddress, count);
+}
+
+void ADS124S08::updateCachedRange(
+	Address				  startAddress,
+	uint8_t				  count,
+	const Register *const values
+) const noexcept {
+	std::copy_n(values, count, &registerCache[startAddress]);
+	registerCacheValid |= registerMask(startAddress, count) & ~ADS124S08_VOLATILE_REGISTERS;
+}
+
+std::pair<uint8_t, uint8_t> ADS124S08::trimCachedWrite(
+	Address				  startAddress,
+	uint8_t				  count,
+	const Register *const buffer
+) const noexcept {
+	// Trim leading and trailing registers the device is already known to hold
+	const auto isCached = [this, startAddress, buffer](uint8_t offset) {
+		const uint8_t address = startAddress + offset;
+		return (registerCacheValid & (1ul << address)) && registerCache[address] == buffer[offset];
+	};
+
+	uint8_t first = 0u;
+	uint8_t last  = count;
+	while (first < last && isCached(first)) first++;
+	while (last > first && isCached(last - 1u)) last--;
+
+	const uint8_t writeCount = last - first;
+	writeStatistics.elidedBytes += count - writeCount;
+	if (writeCount == 0u) writeStatistics.elidedWrites++;
+	return {first, writeCount};
+}
+
 std::optional<ADS124S08::Register> ADS124S08::wakeup() noexcept {
-	return writeSingleByteCommand(spi, ControlCommand::WAKEUP);
+	return sendCommand(spi, ControlCommand::WAKEUP);
 }
 
 std::optional<ADS124S08::Register> ADS124S08::powerdown() noexcept {
-	return writeSingleByteCommand(spi, ControlCommand::POWERDOWN);
+	return sendCommand(spi, ControlCommand::POWERDOWN);
 }
 
 std::optional<ADS124S08::Register> ADS124S08::reset() noexcept {
-	return writeSingleByteCommand(spi, ControlCommand::RESET);
+	const auto result = sendCommand(spi, ControlCommand::RESET);
+	if (result) restoreResetValues();
+	else invalidateRegisterCache();
+	return result;
+}
+
+void ADS124S08::restoreResetValues(void) const noexcept {
+	// The device now holds its reset values; ID is retained as it is device dependent
+	std::copy(RESET_VALUES.begin() + 1u, RESET_VALUES.end(), registerCache.begin() + 1u);
+	registerCacheValid =
+		registerMask(Address::ID, ADS124S08_MAX_REGISTER_COUNT) & ~ADS124S08_VOLATILE_REGISTERS;
 }
 
 std::optional<ADS124S08::Register> ADS124S08::start() noexcept {
-	return writeSingleByteCommand(spi, ControlCommand::START);
+	return sendCommand(spi, ControlCommand::START);
 }
 
 std::optional<ADS124S08::Register> ADS124S08::stop() noexcept {
-	return writeSingleByteCommand(spi, ControlCommand::STOP);
+	return sendCommand(spi, ControlCommand::STOP);
 }
 
 std::optional<ADS124S08::Register> ADS124S08::offsetCalibrate() noexcept {
-	return writeSingleByteCommand(spi, SPI::CalibrationCommand::SYS_OFFSET_CAL);
+	registerCacheValid &= ~ADS124S08_CALIBRATION_REGISTERS;
+	return sendCommand(spi, SPI::CalibrationCommand::SYS_OFFSET_CAL);
 }
 
 std::optional<ADS124S08::Register> ADS124S08::gainCalibrate() noexcept {
-	return writeSingleByteCommand(spi, SPI::CalibrationCommand::SYS_GAIN_CAL);
+	registerCacheValid &= ~ADS124S08_CALIBRATION_REGISTERS;
+	return sendCommand(spi, SPI::CalibrationCommand::SYS_GAIN_CAL);
 }
 
 std::optional<ADS124S08::Register> ADS124S08::selfOffsetCalibrate() noexcept {
-	return writeSingleByteCommand(spi, SPI::CalibrationCommand::SELF_OFFSET_CAL);
+	registerCacheValid &= ~ADS124S08_CALIBRATION_REGISTERS;
+	return sendCommand(spi, SPI::CalibrationCommand::SELF_OFFSET_CAL);
 }
 
 std::optional<Register> ADS124S08::setRegister(const SPI_Register_I &reg) const noexcept {
@@ -185,11 +273,8 @@ std::optional<Register> ADS124S08::setRegister(const SPI_Register_I &reg) const
 }
 
 float ADS124S08::RDATA::toVoltage(float pgaGain, float vRef) const {
-	// Convert 24-bit two's complement data to a signed integer
-	int32_t rawData = static_cast<int32_t>(data);
-	if (rawData & 0x800000) {  // Check if the sign bit is set
-		rawData |= 0xFF000000; // Sign-extend to 32 bits
-	}
+	// Convert 24-bit two's complement data to a signed integer, sign-extending without a branch
+	const int32_t rawData = static_cast<int32_t>(data << 8u) >> 8u;
 
 	// Convert to voltage
 	return (rawData / static_cast<float>(0x800000)) * (vRef / pgaGain);
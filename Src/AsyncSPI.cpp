@@ -0,0 +1,183 @@
+#include "ADS124S08.hpp"
+
+#include <algorithm>
+
+using Register		   = ADS124S08::Register;
+using Address		   = ADS124S08::Address;
+using AsyncTransaction = ADS124S08::AsyncTransaction;
+using State			   = AsyncTransaction::State;
+
+bool AsyncTransaction::start(
+	AsyncSPI		   &spi,
+	const uint8_t		length,
+	AsyncCompletion		completion,
+	void			   *context
+) noexcept {
+	this->completion = completion;
+	this->context	 = context;
+	applied			 = false;
+	status.store(State::PENDING, std::memory_order_relaxed);
+
+	if (spi.transfer(txFrame.data(), rxFrame.data(), length, onTransferComplete, this)) return true;
+
+	status.store(State::FAILED, std::memory_order_release);
+	return false;
+}
+
+void AsyncTransaction::onTransferComplete(void *transaction, const bool success) noexcept {
+	auto *const self = static_cast<AsyncTransaction *>(transaction);
+
+	// Read before publishing the result, after which the caller may reuse the transaction
+	const AsyncCompletion completion = self->completion;
+	void *const			  context	 = self->context;
+
+	self->status.store(success ? State::COMPLETED : State::FAILED, std::memory_order_release);
+	if (completion != nullptr) completion(context, success);
+}
+
+std::optional<ADS124S08::RDATA> AsyncTransaction::conversion(void) const noexcept {
+	if (operation != Operation::RDATA || state() != State::COMPLETED) return std::nullopt;
+	return decodeConversion(&rxFrame[offset], statusByte, crcByte);
+}
+
+const Register *AsyncTransaction::registers(void) const noexcept {
+	if (operation != Operation::RREG || state() != State::COMPLETED) return nullptr;
+	return &rxFrame[offset];
+}
+
+bool ADS124S08::commandAsync(
+	AsyncSPI		 &spi,
+	AsyncTransaction &transaction,
+	Command			  command,
+	AsyncCompletion	  completion,
+	void			 *context
+) const noexcept {
+	if (transaction.pending()) return false;
+
+	transaction.operation  = AsyncTransaction::Operation::COMMAND;
+	transaction.txFrame[0] = command;
+
+	switch (command) {
+	case SPI::CalibrationCommand::SYS_OFFSET_CAL:
+	case SPI::CalibrationCommand::SYS_GAIN_CAL:
+	case SPI::CalibrationCommand::SELF_OFFSET_CAL:
+		invalidateCachedRange(Address::OF_CAL0, 6u); // Updated by the device
+		break;
+
+	case SPI::ControlCommand::RESET:
+		// Unknown until the command is known to be sent, then the reset values
+		invalidateCachedRange(Address::ID, REGISTER_COUNT);
+		break;
+
+	default:
+		break;
+	}
+
+	return transaction.start(spi, 1u, completion, context);
+}
+
+bool ADS124S08::rdataAsync(
+	AsyncSPI		 &spi,
+	AsyncTransaction &transaction,
+	DataReadMode	  mode,
+	AsyncCompletion	  completion,
+	void			 *context
+) const noexcept {
+	if (transaction.pending()) return false;
+
+	const SYS sys{registerCache[Address::SYS]};
+
+	transaction.operation  = AsyncTransaction::Operation::RDATA;
+	transaction.statusByte = sys.sendStat();
+	transaction.crcByte	   = sys.crc();
+	transaction.offset	   = (mode == DataReadMode::COMMAND) ? 1u : 0u; // RDATA byte
+
+	const uint8_t length = transaction.offset + 3u + (transaction.statusByte ? 1u : 0u) +
+						   (transaction.crcByte ? 1u : 0u);
+
+	transaction.txFrame.fill(SPI::ControlCommand::NOP);
+	if (mode == DataReadMode::COMMAND) transaction.txFrame[0] = SPI::DataReadCommand::RDATA;
+
+	return transaction.start(spi, length, completion, context);
+}
+
+bool ADS124S08::rregAsync(
+	AsyncSPI		 &spi,
+	AsyncTransaction &transaction,
+	Address			  startAddress,
+	uint8_t			  count,
+	AsyncCompletion	  completion,
+	void			 *context
+) const noexcept {
+	if (transaction.pending()) return false;
+	if (!validAddressRange(startAddress, count)) return false;
+
+	transaction.operation = AsyncTransaction::Operation::RREG;
+	transaction.address	  = startAddress;
+	transaction.count	  = count;
+	transaction.offset	  = 2u; // Command bytes
+
+	transaction.txFrame.fill(SPI::ControlCommand::NOP);
+	transaction.txFrame[0] = static_cast<Register>(0x20u | startAddress); // RREG command
+	transaction.txFrame[1] = static_cast<Register>(count - 1u);
+
+	return transaction.start(spi, 2u + count, completion, context);
+}
+
+bool ADS124S08::wregAsync(
+	AsyncSPI			 &spi,
+	AsyncTransaction	 &transaction,
+	Address				  startAddress,
+	uint8_t				  count,
+	const Register *const buffer,
+	AsyncCompletion		  completion,
+	void				 *context
+) const noexcept {
+	if (transaction.pending()) return false;
+	if (!validAddressRange(startAddress, count)) return false;
+	if (buffer == nullptr) return false;
+
+	transaction.operation = AsyncTransaction::Operation::WREG;
+	transaction.address	  = startAddress;
+	transaction.count	  = count;
+	transaction.offset	  = 2u; // Command bytes
+
+	transaction.txFrame[0] = static_cast<Register>(0x40u | startAddress); // WREG command
+	transaction.txFrame[1] = static_cast<Register>(count - 1u);
+	std::copy_n(buffer, count, &transaction.txFrame[2]);
+
+	// The device state is unknown until the transfer completes
+	invalidateCachedRange(startAddress, count);
+
+	return transaction.start(spi, 2u + count, completion, context);
+}
+
+std::optional<Register> ADS124S08::completeAsync(const AsyncTransaction &transaction
+) const noexcept {
+	if (transaction.state() != State::COMPLETED) return std::nullopt;
+
+	const bool apply	= !transaction.applied;
+	transaction.applied = true;
+
+	switch (transaction.operation) {
+	case AsyncTransaction::Operation::COMMAND:
+		if (apply && transaction.txFrame[0] == SPI::ControlCommand::RESET) restoreResetValues();
+		return transaction.txFrame[0];
+
+	case AsyncTransaction::Operation::RREG:
+		if (apply) {
+			updateCachedRange(transaction.address, transaction.count, &transaction.rxFrame[2]);
+		}
+		return transaction.rxFrame[2];
+
+	case AsyncTransaction::Operation::WREG:
+		if (apply) {
+			writeStatistics.issuedWrites++;
+			updateCachedRange(transaction.address, transaction.count, &transaction.txFrame[2]);
+		}
+		return transaction.txFrame[2];
+
+	default:
+		return std::nullopt;
+	}
+}
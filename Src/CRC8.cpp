@@ -0,0 +1,129 @@
+#include "ADS124S08.hpp"
+
+using Register = ADS124S08::Register;
+using CRC8	   = ADS124S08::CRC8;
+using RDATA	   = ADS124S08::RDATA;
+
+using CRC8Table = std::array<Register, 256u>;
+
+static constexpr Register crc8Step(Register crc) noexcept {
+	for (uint8_t bit = 0u; bit < 8u; bit++) {
+		crc = (crc & 0x80u) ? static_cast<Register>((crc << 1u) ^ CRC8::POLYNOMIAL)
+							: static_cast<Register>(crc << 1u);
+	}
+	return crc;
+}
+
+// TABLES[k][x] is the CRC of byte x followed by k zero bytes, from a zero preset
+static constexpr std::array<CRC8Table, 4u> makeTables(void) noexcept {
+	std::array<CRC8Table, 4u> tables{};
+	for (uint16_t x = 0u; x < 256u; x++) {
+		tables[0][x] = crc8Step(static_cast<Register>(x));
+	}
+	for (uint8_t k = 1u; k < 4u; k++) {
+		for (uint16_t x = 0u; x < 256u; x++) {
+			tables[k][x] = tables[0][tables[k - 1u][x]];
+		}
+	}
+	return tables;
+}
+
+static constexpr std::array<CRC8Table, 4u> CRC8_TABLES = makeTables();
+
+Register CRC8::bitwise(const Register *const data, std::size_t length, Register crc) noexcept {
+	for (std::size_t i = 0u; i < length; i++) {
+		crc = crc8Step(crc ^ data[i]);
+	}
+	return crc;
+}
+
+Register CRC8::table(const Register *const data, std::size_t length, Register crc) noexcept {
+	for (std::size_t i = 0u; i < length; i++) {
+		crc = CRC8_TABLES[0][crc ^ data[i]];
+	}
+	return crc;
+}
+
+Register CRC8::slicing(const Register *const data, std::size_t length, Register crc) noexcept {
+	std::size_t i = 0u;
+	for (; i + 4u <= length; i += 4u) {
+		crc = CRC8_TABLES[3][crc ^ data[i]] ^ //
+			  CRC8_TABLES[2][data[i + 1u]] ^  //
+			  CRC8_TABLES[1][data[i + 2u]] ^  //
+			  CRC8_TABLES[0][data[i + 3u]];
+	}
+	return table(&data[i], length - i, crc);
+}
+
+Register CRC8::compute(
+	const Register *const data,
+	std::size_t			  length,
+	Backend				  backend,
+	Register			  initial
+) noexcept {
+	switch (backend) {
+	case Backend::BITWISE: return bitwise(data, length, initial);
+	case Backend::SLICING_BY_4: return slicing(data, length, initial);
+	case Backend::TABLE:
+	default: return table(data, length, initial);
+	}
+}
+
+std::size_t CRC8::verifyFrames(
+	const Register *const frames,
+	std::size_t			  frameLength,
+	std::size_t			  count,
+	bool *const			  results,
+	Backend				  backend
+) noexcept {
+	if (frames == nullptr || frameLength < 2u) return count;
+
+	std::size_t failures = 0u;
+	for (std::size_t i = 0u; i < count; i++) {
+		const Register *const frame = &frames[i * frameLength];
+
+		const bool valid = compute(frame, frameLength - 1u, backend) == frame[frameLength - 1u];
+		if (!valid) failures++;
+		if (results != nullptr) results[i] = valid;
+	}
+	return failures;
+}
+
+std::size_t CRC8::verifyBatch(
+	const RDATABatch &batch,
+	std::size_t		  count,
+	bool			  statusEnabled,
+	bool *const		  results,
+	Backend			  backend
+) noexcept {
+	if (batch.data == nullptr || batch.crc == nullptr) return count;
+	if (statusEnabled && batch.status == nullptr) return count;
+
+	std::size_t failures = 0u;
+	for (std::size_t i = 0u; i < count; i++) {
+		Register frame[4u];
+		uint8_t	 length = 0u;
+		if (statusEnabled) frame[length++] = batch.status[i];
+		frame[length++] = static_cast<Register>(batch.data[i] >> 16u);
+		frame[length++] = static_cast<Register>(batch.data[i] >> 8u);
+		frame[length++] = static_cast<Register>(batch.data[i]);
+
+		const bool valid = compute(frame, length, backend) == batch.crc[i];
+		if (!valid) failures++;
+		if (results != nullptr) results[i] = valid;
+	}
+	return failures;
+}
+
+std::optional<bool> RDATA::crcValid(void) const noexcept {
+	if (!crc) return std::nullopt;
+
+	Register frame[4u];
+	uint8_t	 length = 0u;
+	if (status) frame[length++] = *status;
+	frame[length++] = static_cast<Register>(data >> 16u);
+	frame[length++] = static_cast<Register>(data >> 8u);
+	frame[length++] = static_cast<Register>(data);
+
+	return CRC8::compute(frame, length) == *crc;
+}
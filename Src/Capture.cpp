@@ -0,0 +1,207 @@
+#include "ADS124S08.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using Register		= ADS124S08::Register;
+using CaptureHeader = ADS124S08::CaptureHeader;
+using CaptureWriter = ADS124S08::CaptureWriter;
+using CaptureView	= ADS124S08::CaptureView;
+
+static constexpr Register	 CAPTURE_FLAG_STATUS	 = 0x01u;
+static constexpr Register	 CAPTURE_FLAG_CRC		 = 0x02u;
+static constexpr std::size_t CAPTURE_REGISTER_OFFSET = 32u;
+
+static void storeLittleEndian(Register *const buffer, uint64_t value, uint8_t bytes) noexcept {
+	for (uint8_t i = 0u; i < bytes; i++) {
+		buffer[i] = static_cast<Register>(value >> (8u * i));
+	}
+}
+
+static uint64_t loadLittleEndian(const Register *const buffer, uint8_t bytes) noexcept {
+	uint64_t value = 0u;
+	for (uint8_t i = bytes; i > 0u; i--) {
+		value = (value << 8u) | buffer[i - 1u];
+	}
+	return value;
+}
+
+CaptureHeader CaptureHeader::fromDriver(
+	const ADS124S08 &adc,
+	uint64_t		 startNanoseconds,
+	uint32_t		 clockHz
+) noexcept {
+	CaptureHeader header{};
+	header.clockHz			= clockHz;
+	header.startNanoseconds = startNanoseconds;
+	header.registersValid	= adc.registerCacheValid & ((1u << REGISTER_COUNT) - 1u);
+	for (uint8_t i = 0u; i < REGISTER_COUNT; i++) {
+		if ((header.registersValid & (1u << i)) != 0u) header.registers[i] = adc.registerCache[i];
+	}
+
+	const SYS sys{adc.registerCache[Address::SYS]};
+	header.statusByte = sys.sendStat();
+	header.crcByte	  = sys.crc();
+	return header;
+}
+
+void CaptureHeader::serialize(Register *const buffer) const noexcept {
+	std::fill_n(buffer, SIZE, 0x00u);
+	std::copy(MAGIC.begin(), MAGIC.end(), buffer);
+
+	storeLittleEndian(&buffer[8], VERSION, 2u);
+	storeLittleEndian(&buffer[10], SIZE, 2u);
+	buffer[12] = (statusByte ? CAPTURE_FLAG_STATUS : 0u) | (crcByte ? CAPTURE_FLAG_CRC : 0u);
+	buffer[13] = recordSize();
+	buffer[14] = REGISTER_COUNT;
+	storeLittleEndian(&buffer[16], clockHz, 4u);
+	storeLittleEndian(&buffer[20], registersValid, 4u);
+	storeLittleEndian(&buffer[24], startNanoseconds, 8u);
+	std::copy(registers.begin(), registers.end(), &buffer[CAPTURE_REGISTER_OFFSET]);
+}
+
+std::optional<CaptureHeader> CaptureHeader::parse(
+	const Register *const buffer,
+	std::size_t			  size
+) noexcept {
+	if (buffer == nullptr || size < SIZE) return std::nullopt;
+	if (!std::equal(MAGIC.begin(), MAGIC.end(), buffer)) return std::nullopt;
+	if (loadLittleEndian(&buffer[8], 2u) != VERSION) return std::nullopt;
+	if (loadLittleEndian(&buffer[10], 2u) != SIZE) return std::nullopt;
+	if (buffer[14] != REGISTER_COUNT) return std::nullopt;
+
+	CaptureHeader header{};
+	header.statusByte		= (buffer[12] & CAPTURE_FLAG_STATUS) != 0u;
+	header.crcByte			= (buffer[12] & CAPTURE_FLAG_CRC) != 0u;
+	header.clockHz			= static_cast<uint32_t>(loadLittleEndian(&buffer[16], 4u));
+	header.startNanoseconds = loadLittleEndian(&buffer[24], 8u);
+	header.registersValid	= static_cast<uint32_t>(loadLittleEndian(&buffer[20], 4u));
+	std::copy_n(&buffer[CAPTURE_REGISTER_OFFSET], REGISTER_COUNT, header.registers.begin());
+
+	if (buffer[13] != header.recordSize()) return std::nullopt;
+	return header;
+}
+
+bool CaptureWriter::writeFile(void *file, const Register *data, std::size_t count) noexcept {
+	return std::fwrite(data, 1u, count, static_cast<std::FILE *>(file)) == count;
+}
+
+bool CaptureWriter::begin(const CaptureHeader &header) noexcept {
+	if (failure || !reserve(CaptureHeader::SIZE)) return false;
+
+	header.serialize(&buffer[used]);
+	used += CaptureHeader::SIZE;
+
+	statusByte = header.statusByte;
+	crcByte	   = header.crcByte;
+	begun	   = true;
+	records	   = 0u;
+	return true;
+}
+
+bool CaptureWriter::reserve(std::size_t count) noexcept {
+	if (used + count <= BUFFER_SIZE) return true;
+	return flush();
+}
+
+void CaptureWriter::pack(
+	std::optional<Register> status,
+	uint32_t				data,
+	std::optional<Register> crc
+) noexcept {
+	if (statusByte) buffer[used++] = status.value_or(0x00u);
+	buffer[used++] = static_cast<Register>(data >> 16u);
+	buffer[used++] = static_cast<Register>(data >> 8u);
+	buffer[used++] = static_cast<Register>(data);
+	if (crcByte) buffer[used++] = crc.value_or(0x00u);
+	records++;
+}
+
+bool CaptureWriter::append(const RDATA &data) noexcept {
+	if (!begun || failure || !reserve(5u)) return false;
+
+	pack(data.status, data.data, data.crc);
+	return true;
+}
+
+std::size_t CaptureWriter::append(const RDATABatch &batch, std::size_t count) noexcept {
+	if (!begun || batch.data == nullptr) return 0u;
+
+	for (std::size_t i = 0u; i < count; i++) {
+		if (failure || !reserve(5u)) return i;
+
+		std::optional<Register> status{}, crc{};
+		if (batch.status != nullptr) status = batch.status[i];
+		if (batch.crc != nullptr) crc = batch.crc[i];
+		pack(status, batch.data[i], crc);
+	}
+	return count;
+}
+
+bool CaptureWriter::flush(void) noexcept {
+	if (failure) return false;
+
+	if (used != 0u && (sink == nullptr || !sink(context, buffer.data(), used))) failure = true;
+	used = 0u;
+	return !failure;
+}
+
+bool CaptureWriter::record(void *writer, const RDATA &data) noexcept {
+	return static_cast<CaptureWriter *>(writer)->append(data);
+}
+
+std::optional<CaptureView> CaptureView::parse(
+	const Register *const data,
+	std::size_t			  size
+) noexcept {
+	const auto header = CaptureHeader::parse(data, size);
+	if (!header) return std::nullopt;
+
+	const std::size_t count = (size - CaptureHeader::SIZE) / header->recordSize();
+	return CaptureView{*header, &data[CaptureHeader::SIZE], count};
+}
+
+#if __has_include(<sys/mman.h>)
+using CaptureFile = ADS124S08::CaptureFile;
+
+std::optional<CaptureView> CaptureFile::open(const char *path) noexcept {
+	close();
+
+	const int fd = ::open(path, O_RDONLY);
+	if (fd < 0) return std::nullopt;
+
+	struct stat status {};
+	if (::fstat(fd, &status) != 0 || status.st_size < static_cast<off_t>(CaptureHeader::SIZE)) {
+		::close(fd);
+		return std::nullopt;
+	}
+
+	const auto size	   = static_cast<std::size_t>(status.st_size);
+	void *const memory = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd); // The mapping holds its own reference to the file
+	if (memory == MAP_FAILED) return std::nullopt;
+
+	mapping = static_cast<const Register *>(memory);
+	length	= size;
+
+	// Records are read front to back
+	::madvise(memory, size, MADV_SEQUENTIAL);
+
+	const auto view = CaptureView::parse(mapping, length);
+	if (!view) close();
+	return view;
+}
+
+void CaptureFile::close(void) noexcept {
+	if (mapping != nullptr) ::munmap(const_cast<Register *>(mapping), length);
+	mapping = nullptr;
+	length	= 0u;
+}
+#endif
@@ -0,0 +1,75 @@
+#include "ADS124S08.hpp"
+
+using DataReady		  = ADS124S08::DataReady;
+using EdgeDataReady	  = ADS124S08::EdgeDataReady;
+using StatusDataReady = ADS124S08::StatusDataReady;
+using Address		  = ADS124S08::Address;
+
+bool EdgeDataReady::wait(uint32_t timeoutMicroseconds) noexcept {
+	// Without a sleep no time can be measured, so a timeout cannot be honoured
+	const bool timed = timeoutMicroseconds != 0u && timeoutMicroseconds != WAIT_FOREVER;
+	if (timed && sleep == nullptr) return false;
+
+	uint32_t elapsed = 0u;
+	while (true) {
+		const uint32_t pending = edges.exchange(0u, std::memory_order_acquire);
+		if (pending != 0u) {
+			missed += pending - 1u;
+			return true;
+		}
+
+		if (timeoutMicroseconds != WAIT_FOREVER && elapsed >= timeoutMicroseconds) return false;
+		if (sleep != nullptr) sleep(context, pollMicroseconds);
+		elapsed += pollMicroseconds;
+	}
+}
+
+bool StatusDataReady::wait(uint32_t timeoutMicroseconds) noexcept {
+	if (sleep == nullptr) return false;
+
+	const auto hasTime = [timeoutMicroseconds](uint32_t elapsed, uint32_t duration) {
+		return timeoutMicroseconds == WAIT_FOREVER || elapsed + duration <= timeoutMicroseconds;
+	};
+
+	uint32_t elapsed = 0u;
+	while (true) {
+		const auto status = adc.rreg(Address::STATUS);
+		if (status && ADS124S08::STATUS{*status}.get_RDY() == ADS124S08::STATUS::Dev_RDY::READY) {
+			break;
+		}
+
+		if (!hasTime(elapsed, pollMicroseconds)) return false;
+		sleep(context, pollMicroseconds);
+		elapsed += pollMicroseconds;
+	}
+
+	const ADS124S08::PGA	  pga{adc.getCachedRegister(Address::PGA).value_or(0x00u)};
+	const ADS124S08::DATARATE datarate{
+		adc.getCachedRegister(Address::DATA_RATE).value_or(ADS124S08::DATARATE{}.value())
+	};
+	const uint32_t period =
+		ADS124S08::LatencyModel::compute(pga, datarate).periodMicroseconds(clockHz);
+
+	if (!hasTime(elapsed, period)) return false;
+	sleep(context, period);
+	return true;
+}
+
+std::size_t ADS124S08::acquire(
+	DataReady		 &dataReady,
+	std::size_t		  count,
+	ConversionHandler handler,
+	void			 *context,
+	uint32_t		  timeoutMicroseconds,
+	DataReadMode	  mode
+) const noexcept {
+	for (std::size_t i = 0u; i < count; i++) {
+		if (!dataReady.wait(timeoutMicroseconds)) return i;
+
+		const auto result = rdata(mode);
+		if (!result) return i;
+
+		if (handler != nullptr && !handler(context, *result)) return i + 1u;
+	}
+	return count;
+}
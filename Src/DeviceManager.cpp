@@ -0,0 +1,40 @@
+#include "ADS124S08.hpp"
+
+using Register		= ADS124S08::Register;
+using ChipSelectSPI = ADS124S08::ChipSelectSPI;
+
+bool ChipSelectSPI::select(void) noexcept {
+	if (!bus.acquire()) return false;
+	if (chipSelect != nullptr) chipSelect(context, true);
+	return true;
+}
+
+void ChipSelectSPI::deselect(void) noexcept {
+	if (chipSelect != nullptr) chipSelect(context, false);
+	bus.release();
+}
+
+std::optional<uint8_t> ChipSelectSPI::read(Register *const buffer, uint8_t count) noexcept {
+	if (!select()) return std::nullopt;
+	const auto result = bus.transport().read(buffer, count);
+	deselect();
+	return result;
+}
+
+std::optional<uint8_t> ChipSelectSPI::write(const Register *const buffer, uint8_t count) noexcept {
+	if (!select()) return std::nullopt;
+	const auto result = bus.transport().write(buffer, count);
+	deselect();
+	return result;
+}
+
+std::optional<std::tuple<uint8_t, uint8_t>> ChipSelectSPI::readWrite(
+	const Register *const txBuffer,
+	Register *const		  rxBuffer,
+	uint8_t				  count
+) noexcept {
+	if (!select()) return std::nullopt;
+	const auto result = bus.transport().readWrite(txBuffer, rxBuffer, count);
+	deselect();
+	return result;
+}
@@ -0,0 +1,108 @@
+#include "ADS124S08.hpp"
+
+using Register		  = ADS124S08::Register;
+using InstrumentedSPI = ADS124S08::InstrumentedSPI;
+
+InstrumentedSPI::InstrumentedSPI(SPI &spi, TimeSource timeSource, void *context) noexcept
+	: spi(spi), timeSource(timeSource), timeSourceContext(context) {
+	reset();
+}
+
+void InstrumentedSPI::setTracer(Tracer tracer, void *context) noexcept {
+	this->tracer  = tracer;
+	tracerContext = context;
+}
+
+void InstrumentedSPI::reset(void) noexcept {
+	statistics = {};
+	for (auto &operation : statistics.operations) {
+		operation.minNanoseconds = UINT32_MAX;
+	}
+}
+
+InstrumentedSPI::Operation InstrumentedSPI::classify(Register opcode) noexcept {
+	if ((opcode & 0xE0u) == 0x20u) return Operation::RREG;
+	if ((opcode & 0xE0u) == 0x40u) return Operation::WREG;
+	if (opcode == ControlCommand::NOP || (opcode & 0xFEu) == DataReadCommand::RDATA) {
+		return Operation::RDATA;
+	}
+	return Operation::COMMAND;
+}
+
+uint8_t InstrumentedSPI::bucket(uint32_t nanoseconds) noexcept {
+	uint8_t index = 0u;
+	for (uint32_t rest = nanoseconds >> HISTOGRAM_SHIFT; rest != 0u; rest >>= 1u) index++;
+	return std::min<uint8_t>(index, HISTOGRAM_BUCKETS - 1u);
+}
+
+// Opcode of a transfer; a transfer without transmit data clocks out NOPs
+static Register opcodeOf(const Register *const txBuffer, uint8_t count) noexcept {
+	return (txBuffer != nullptr && count != 0u) ? txBuffer[0] : Register{ADS124S08::SPI::NOP};
+}
+
+uint64_t InstrumentedSPI::now(void) const noexcept {
+	return timeSource != nullptr ? timeSource(timeSourceContext) : 0u;
+}
+
+void InstrumentedSPI::record(
+	Register opcode,
+	uint8_t	 count,
+	uint8_t	 transferred,
+	bool	 success,
+	uint64_t start
+) noexcept {
+	const uint64_t	end		  = (timeSource != nullptr) ? now() : 0u;
+	const uint32_t	duration  = static_cast<uint32_t>(std::min<uint64_t>(end - start, UINT32_MAX));
+	const Operation operation = classify(opcode);
+
+	auto &entry = statistics.operations[static_cast<uint8_t>(operation)];
+	entry.count++;
+	entry.bytes += transferred;
+	if (!success) entry.failures++;
+
+	if (timeSource != nullptr) {
+		entry.totalNanoseconds += duration;
+		entry.minNanoseconds = std::min(entry.minNanoseconds, duration);
+		entry.maxNanoseconds = std::max(entry.maxNanoseconds, duration);
+		entry.histogram[bucket(duration)]++;
+	}
+
+	if (tracer != nullptr) {
+		tracer(tracerContext, Trace{operation, opcode, count, success, start, duration});
+	}
+}
+
+std::optional<uint8_t> InstrumentedSPI::read(Register *const buffer, uint8_t count) noexcept {
+	if constexpr (!ENABLED) return spi.read(buffer, count);
+
+	const uint64_t start  = now();
+	const auto	   result = spi.read(buffer, count);
+	record(ControlCommand::NOP, count, result.value_or(0u), result.has_value(), start);
+	return result;
+}
+
+std::optional<uint8_t> InstrumentedSPI::write(
+	const Register *const buffer,
+	uint8_t				  count
+) noexcept {
+	if constexpr (!ENABLED) return spi.write(buffer, count);
+
+	const uint64_t start  = now();
+	const auto	   result = spi.write(buffer, count);
+	record(opcodeOf(buffer, count), count, result.value_or(0u), result.has_value(), start);
+	return result;
+}
+
+std::optional<std::tuple<uint8_t, uint8_t>> InstrumentedSPI::readWrite(
+	const Register *const txBuffer,
+	Register *const		  rxBuffer,
+	uint8_t				  count
+) noexcept {
+	if constexpr (!ENABLED) return spi.readWrite(txBuffer, rxBuffer, count);
+
+	const uint64_t start	   = now();
+	const auto	   result	   = spi.readWrite(txBuffer, rxBuffer, count);
+	const uint8_t  transferred = result ? std::get<0>(*result) : 0u;
+	record(opcodeOf(txBuffer, count), count, transferred, result.has_value(), start);
+	return result;
+}
@@ -0,0 +1,147 @@
+#include "ADS124S08.hpp"
+
+using LatencyModel	   = ADS124S08::LatencyModel;
+using CONVERSION_DELAY = LatencyModel::CONVERSION_DELAY;
+using DataRate		   = LatencyModel::DataRate;
+using FilterSelect	   = LatencyModel::FilterSelect;
+using ChopperEnable	   = LatencyModel::ChopperEnable;
+
+// Indexed by CONVERSION_DELAY
+static constexpr std::array<uint32_t, 8u> LATENCY_CONVERSION_DELAYS = {
+	14u, 25u, 64u, 256u, 1024u, 2048u, 4096u, 1u,
+};
+
+// Indexed by DataRate, f_MOD / f_DATA with f_MOD = 256 kHz
+static constexpr std::array<uint32_t, 16u> LATENCY_DECIMATION_RATIOS = {
+	102400u, // 2.5 SPS
+	51200u,	 // 5 SPS
+	25600u,	 // 10 SPS
+	15360u,	 // 16.6 SPS
+	12800u,	 // 20 SPS
+	5120u,	 // 50 SPS
+	4267u,	 // 60 SPS
+	2560u,	 // 100 SPS
+	1280u,	 // 200 SPS
+	640u,	 // 400 SPS
+	320u,	 // 800 SPS
+	256u,	 // 1000 SPS
+	128u,	 // 2000 SPS
+	64u,	 // 4000 SPS
+	64u,	 // 4000 SPS
+	64u,	 // Reserved
+};
+
+// -3 dB bandwidth as a fraction of the data rate
+static constexpr float LATENCY_SINC3_BANDWIDTH		 = 0.262f;
+static constexpr float LATENCY_LOW_LATENCY_BANDWIDTH = 0.44f;
+
+static constexpr uint32_t toMicroseconds(const uint32_t tMod, const uint32_t clockHz) noexcept {
+	if (clockHz == 0u) return 0u;
+	const uint64_t clocks = uint64_t{tMod} * LatencyModel::MODULATOR_DIVIDER * 1000000u;
+	return static_cast<uint32_t>((clocks + clockHz - 1u) / clockHz); // Round up
+}
+
+uint32_t LatencyModel::Latency::firstSampleMicroseconds(uint32_t clockHz) const noexcept {
+	return toMicroseconds(firstSample, clockHz);
+}
+
+uint32_t LatencyModel::Latency::periodMicroseconds(uint32_t clockHz) const noexcept {
+	return toMicroseconds(period, clockHz);
+}
+
+uint64_t LatencyModel::nanoseconds(uint32_t tMod, uint32_t clockHz) noexcept {
+	if (clockHz == 0u) return 0u;
+	const uint64_t clocks = uint64_t{tMod} * MODULATOR_DIVIDER * 1000000000u;
+	return (clocks + clockHz / 2u) / clockHz;
+}
+
+uint32_t LatencyModel::conversionDelay(CONVERSION_DELAY delay) noexcept {
+	return LATENCY_CONVERSION_DELAYS[static_cast<Register>(delay) & 0x07u];
+}
+
+uint32_t LatencyModel::decimationRatio(DataRate rate) noexcept {
+	return LATENCY_DECIMATION_RATIOS[static_cast<Register>(rate) & 0x0Fu];
+}
+
+uint8_t LatencyModel::settlingPeriods(FilterSelect filter) noexcept {
+	return filter == FilterSelect::SINC3 ? 3u : 1u;
+}
+
+float LatencyModel::bandwidth(DataRate rate, FilterSelect filter, uint32_t clockHz) noexcept {
+	const float dataRate =
+		static_cast<float>(clockHz) / static_cast<float>(MODULATOR_DIVIDER * decimationRatio(rate));
+	const float bandwidthRatio =
+		filter == FilterSelect::SINC3 ? LATENCY_SINC3_BANDWIDTH : LATENCY_LOW_LATENCY_BANDWIDTH;
+	return dataRate * bandwidthRatio;
+}
+
+LatencyModel::Latency LatencyModel::compute(
+	CONVERSION_DELAY delay,
+	DataRate		 rate,
+	FilterSelect	 filter,
+	ChopperEnable	 chop
+) noexcept {
+	const uint32_t settled =
+		conversionDelay(delay) + settlingPeriods(filter) * decimationRatio(rate);
+
+	if (chop == ChopperEnable::ENABLED) {
+		return Latency{2u * settled, settled};
+	}
+	return Latency{settled, decimationRatio(rate)};
+}
+
+LatencyModel::Latency LatencyModel::compute(const PGA &pga, const DATARATE &datarate) noexcept {
+	return compute(
+		pga.getDelay(),
+		datarate.getDataRate(),
+		datarate.getFilter(),
+		datarate.getGlobalChop()
+	);
+}
+
+void LatencyModel::Configuration::apply(PGA &pga, DATARATE &datarate) const noexcept {
+	pga.setDelay(delay);
+	datarate.setDataRate(rate).setFilter(filter).setGlobalChop(chop);
+}
+
+std::optional<LatencyModel::Configuration>
+LatencyModel::schedule(const Requirements &requirements) noexcept {
+	if (requirements.clockHz == 0u) return std::nullopt;
+
+	// Shortest delay covering the analog settling time
+	std::optional<CONVERSION_DELAY> delay;
+	for (uint8_t code = 0u; code < 8u; code++) {
+		const auto candidate = static_cast<CONVERSION_DELAY>(code);
+		if (toMicroseconds(conversionDelay(candidate), requirements.clockHz) <
+			requirements.settlingMicroseconds) {
+			continue;
+		}
+		if (!delay || conversionDelay(candidate) < conversionDelay(*delay)) delay = candidate;
+	}
+	if (!delay) return std::nullopt;
+
+	const ChopperEnable chop =
+		requirements.globalChop ? ChopperEnable::ENABLED : ChopperEnable::DISABLED;
+
+	std::optional<Configuration> best;
+	float						 bestBandwidth = 0.0f;
+
+	for (const auto filter : {FilterSelect::SINC3, FilterSelect::LOW_LATENCY}) {
+		for (uint8_t code = 0u; code <= static_cast<Register>(DataRate::RATE_4000); code++) {
+			const auto	rate = static_cast<DataRate>(code);
+			const float bw	 = bandwidth(rate, filter, requirements.clockHz);
+			if (bw < requirements.minBandwidth || bw > requirements.maxBandwidth) continue;
+
+			const Latency latency = compute(*delay, rate, filter, chop);
+			if (best) {
+				if (latency.firstSample > best->latency.firstSample) continue;
+				const bool sameLatency = latency.firstSample == best->latency.firstSample;
+				if (sameLatency && bw >= bestBandwidth) continue;
+			}
+
+			best		  = Configuration{*delay, rate, filter, chop, latency};
+			bestBandwidth = bw;
+		}
+	}
+	return best;
+}
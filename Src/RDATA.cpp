@@ -0,0 +1,205 @@
+#include "ADS124S08.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+using Register = ADS124S08::Register;
+using RDATA	   = ADS124S08::RDATA;
+
+static constexpr double ADS124S08_FULL_SCALE_CODE = static_cast<double>(0x800000u);
+
+static inline int32_t signExtend(const uint32_t code) noexcept {
+	return static_cast<int32_t>(code << 8u) >> 8u;
+}
+
+static inline uint32_t unpackFrame(const Register *const frame) noexcept {
+	return (static_cast<uint32_t>(frame[0]) << 16u) | //
+		   (static_cast<uint32_t>(frame[1]) << 8u) |  //
+		   (static_cast<uint32_t>(frame[2]));
+}
+
+#if defined(__SSSE3__)
+// Place each 3-byte big-endian frame in the upper 24 bits of a 32-bit lane
+static inline __m128i unpackFrames4(const Register *const frames) noexcept {
+	const __m128i shuffle = _mm_setr_epi8(
+		-1, 2, 1, 0, //
+		-1, 5, 4, 3, //
+		-1, 8, 7, 6, //
+		-1, 11, 10, 9
+	);
+	const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(frames));
+	return _mm_srai_epi32(_mm_shuffle_epi8(bytes, shuffle), 8);
+}
+#endif
+
+void RDATA::toVoltages(
+	const uint32_t *const codes,
+	float *const		  voltages,
+	const std::size_t	  count,
+	const float			  pgaGain,
+	const float			  vRef
+) noexcept {
+	const float scale = static_cast<float>(vRef / (pgaGain * ADS124S08_FULL_SCALE_CODE));
+	std::size_t i	  = 0u;
+
+#if defined(__AVX2__)
+	const __m256 scale8 = _mm256_set1_ps(scale);
+	for (; i + 8u <= count; i += 8u) {
+		__m256i raw = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&codes[i]));
+		raw			= _mm256_srai_epi32(_mm256_slli_epi32(raw, 8), 8);
+		_mm256_storeu_ps(&voltages[i], _mm256_mul_ps(_mm256_cvtepi32_ps(raw), scale8));
+	}
+#elif defined(__SSE2__)
+	const __m128 scale4 = _mm_set1_ps(scale);
+	for (; i + 4u <= count; i += 4u) {
+		__m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&codes[i]));
+		raw			= _mm_srai_epi32(_mm_slli_epi32(raw, 8), 8);
+		_mm_storeu_ps(&voltages[i], _mm_mul_ps(_mm_cvtepi32_ps(raw), scale4));
+	}
+#elif defined(__ARM_NEON)
+	for (; i + 4u <= count; i += 4u) {
+		const int32x4_t codes4 = vreinterpretq_s32_u32(vld1q_u32(&codes[i]));
+		const int32x4_t raw	   = vshrq_n_s32(vshlq_n_s32(codes4, 8), 8);
+		vst1q_f32(&voltages[i], vmulq_n_f32(vcvtq_f32_s32(raw), scale));
+	}
+#endif
+
+	for (; i < count; i++) {
+		voltages[i] = static_cast<float>(signExtend(codes[i])) * scale;
+	}
+}
+
+void RDATA::toVoltages(
+	const uint32_t *const codes,
+	double *const		  voltages,
+	const std::size_t	  count,
+	const double		  pgaGain,
+	const double		  vRef
+) noexcept {
+	const double scale = vRef / (pgaGain * ADS124S08_FULL_SCALE_CODE);
+	std::size_t	 i	   = 0u;
+
+#if defined(__AVX2__)
+	const __m256d scale4 = _mm256_set1_pd(scale);
+	for (; i + 4u <= count; i += 4u) {
+		__m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&codes[i]));
+		raw			= _mm_srai_epi32(_mm_slli_epi32(raw, 8), 8);
+		_mm256_storeu_pd(&voltages[i], _mm256_mul_pd(_mm256_cvtepi32_pd(raw), scale4));
+	}
+#elif defined(__SSE2__)
+	const __m128d scale2 = _mm_set1_pd(scale);
+	for (; i + 4u <= count; i += 4u) {
+		__m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&codes[i]));
+		raw			= _mm_srai_epi32(_mm_slli_epi32(raw, 8), 8);
+		_mm_storeu_pd(&voltages[i], _mm_mul_pd(_mm_cvtepi32_pd(raw), scale2));
+		const __m128i upper = _mm_srli_si128(raw, 8);
+		_mm_storeu_pd(&voltages[i + 2u], _mm_mul_pd(_mm_cvtepi32_pd(upper), scale2));
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	for (; i + 2u <= count; i += 2u) {
+		const int32x2_t codes2 = vreinterpret_s32_u32(vld1_u32(&codes[i]));
+		const int32x2_t raw	   = vshr_n_s32(vshl_n_s32(codes2, 8), 8);
+		vst1q_f64(&voltages[i], vmulq_n_f64(vcvtq_f64_s64(vmovl_s32(raw)), scale));
+	}
+#endif
+
+	for (; i < count; i++) {
+		voltages[i] = static_cast<double>(signExtend(codes[i])) * scale;
+	}
+}
+
+void RDATA::framesToVoltages(
+	const Register *const frames,
+	float *const		  voltages,
+	const std::size_t	  count,
+	const float			  pgaGain,
+	const float			  vRef
+) noexcept {
+	const float scale = static_cast<float>(vRef / (pgaGain * ADS124S08_FULL_SCALE_CODE));
+	std::size_t i	  = 0u;
+
+#if defined(__AVX2__)
+	// Each 16-byte load covers 4 frames plus 4 bytes of the next, so stop 2 frames early
+	const __m256 scale8 = _mm256_set1_ps(scale);
+	for (; i + 10u <= count; i += 8u) {
+		const __m256i raw = _mm256_set_m128i(
+			unpackFrames4(&frames[3u * (i + 4u)]), //
+			unpackFrames4(&frames[3u * i])
+		);
+		_mm256_storeu_ps(&voltages[i], _mm256_mul_ps(_mm256_cvtepi32_ps(raw), scale8));
+	}
+#elif defined(__SSSE3__)
+	const __m128 scale4 = _mm_set1_ps(scale);
+	for (; i + 6u <= count; i += 4u) {
+		const __m128i raw = unpackFrames4(&frames[3u * i]);
+		_mm_storeu_ps(&voltages[i], _mm_mul_ps(_mm_cvtepi32_ps(raw), scale4));
+	}
+#elif defined(__ARM_NEON)
+	for (; i + 8u <= count; i += 8u) {
+		const uint8x8x3_t bytes = vld3_u8(&frames[3u * i]); // De-interleave MSB, mid, LSB
+
+		const uint16x8_t msb = vmovl_u8(bytes.val[0]);
+		const uint16x8_t mid = vshlq_n_u16(vmovl_u8(bytes.val[1]), 8);
+		const uint16x8_t low = vorrq_u16(mid, vmovl_u8(bytes.val[2]));
+
+		// Place the 24-bit code in the upper bits of each lane then arithmetic shift down
+		const int32x4_t rawLow = vshrq_n_s32(
+			vreinterpretq_s32_u32(vshlq_n_u32(
+				vorrq_u32(vshll_n_u16(vget_low_u16(msb), 16), vmovl_u16(vget_low_u16(low))), 8
+			)),
+			8
+		);
+		const int32x4_t rawHigh = vshrq_n_s32(
+			vreinterpretq_s32_u32(vshlq_n_u32(
+				vorrq_u32(vshll_n_u16(vget_high_u16(msb), 16), vmovl_u16(vget_high_u16(low))), 8
+			)),
+			8
+		);
+
+		vst1q_f32(&voltages[i], vmulq_n_f32(vcvtq_f32_s32(rawLow), scale));
+		vst1q_f32(&voltages[i + 4u], vmulq_n_f32(vcvtq_f32_s32(rawHigh), scale));
+	}
+#endif
+
+	for (; i < count; i++) {
+		voltages[i] = static_cast<float>(signExtend(unpackFrame(&frames[3u * i]))) * scale;
+	}
+}
+
+void RDATA::framesToVoltages(
+	const Register *const frames,
+	double *const		  voltages,
+	const std::size_t	  count,
+	const double		  pgaGain,
+	const double		  vRef
+) noexcept {
+	const double scale = vRef / (pgaGain * ADS124S08_FULL_SCALE_CODE);
+	std::size_t	 i	   = 0u;
+
+#if defined(__AVX2__)
+	const __m256d scale4 = _mm256_set1_pd(scale);
+	for (; i + 6u <= count; i += 4u) {
+		const __m128i raw = unpackFrames4(&frames[3u * i]);
+		_mm256_storeu_pd(&voltages[i], _mm256_mul_pd(_mm256_cvtepi32_pd(raw), scale4));
+	}
+#elif defined(__SSSE3__)
+	const __m128d scale2 = _mm_set1_pd(scale);
+	for (; i + 6u <= count; i += 4u) {
+		const __m128i raw = unpackFrames4(&frames[3u * i]);
+		_mm_storeu_pd(&voltages[i], _mm_mul_pd(_mm_cvtepi32_pd(raw), scale2));
+		const __m128i upper = _mm_srli_si128(raw, 8);
+		_mm_storeu_pd(&voltages[i + 2u], _mm_mul_pd(_mm_cvtepi32_pd(upper), scale2));
+	}
+#endif
+
+	for (; i < count; i++) {
+		voltages[i] = static_cast<double>(signExtend(unpackFrame(&frames[3u * i]))) * scale;
+	}
+}
@@ -0,0 +1,192 @@
+#include "ADS124S08.hpp"
+
+#include <algorithm>
+
+using Register	   = ADS124S08::Register;
+using SPILog	   = ADS124S08::SPILog;
+using RecordingSPI = ADS124S08::RecordingSPI;
+using ReplaySPI	   = ADS124S08::ReplaySPI;
+
+static constexpr std::size_t REPLAY_ENTRY_HEADER = 2u; // Kind and count
+
+// Largest entry: header, byte counts, then transmitted and received bytes of a 255-byte transfer
+static constexpr std::size_t REPLAY_MAX_ENTRY = REPLAY_ENTRY_HEADER + 2u + 2u * UINT8_MAX;
+
+static bool hasTransmit(SPILog::Kind kind) noexcept { return kind != SPILog::Kind::READ; }
+static bool hasReceive(SPILog::Kind kind) noexcept { return kind != SPILog::Kind::WRITE; }
+
+// Number of byte counts a successful transfer returns
+static uint8_t transferredSize(SPILog::Kind kind) noexcept {
+	return kind == SPILog::Kind::READ_WRITE ? 2u : 1u;
+}
+
+bool RecordingSPI::begin(void) noexcept {
+	Register header[SPILog::HEADER_SIZE];
+	std::copy(SPILog::MAGIC.begin(), SPILog::MAGIC.end(), header);
+	header[SPILog::MAGIC.size()] = SPILog::VERSION;
+
+	if (sink == nullptr || !sink(context, header, sizeof(header))) failure = true;
+	return !failure;
+}
+
+void RecordingSPI::log(
+	SPILog::Kind		  kind,
+	const Register *const txBuffer,
+	const Register *const rxBuffer,
+	uint8_t				  count,
+	const Register *const transferred
+) noexcept {
+	if (failure) return;
+
+	const bool	success = transferred != nullptr;
+	Register	entry[REPLAY_MAX_ENTRY];
+	std::size_t length = 0u;
+
+	entry[length++] = static_cast<Register>(kind) | (success ? 0u : SPILog::FAILED);
+	entry[length++] = count;
+
+	if (success) {
+		std::copy_n(transferred, transferredSize(kind), &entry[length]);
+		length += transferredSize(kind);
+	}
+
+	if (hasTransmit(kind)) {
+		if (txBuffer != nullptr) std::copy_n(txBuffer, count, &entry[length]);
+		else std::fill_n(&entry[length], count, 0x00u);
+		length += count;
+	}
+	if (hasReceive(kind) && success) {
+		if (rxBuffer != nullptr) std::copy_n(rxBuffer, count, &entry[length]);
+		else std::fill_n(&entry[length], count, 0x00u);
+		length += count;
+	}
+
+	if (sink == nullptr || !sink(context, entry, length)) failure = true;
+}
+
+std::optional<uint8_t> RecordingSPI::read(Register *const buffer, uint8_t count) noexcept {
+	const auto	   result		  = spi.read(buffer, count);
+	const Register transferred[1u] = {result.value_or(0u)};
+	log(SPILog::Kind::READ, nullptr, buffer, count, result ? transferred : nullptr);
+	return result;
+}
+
+std::optional<uint8_t> RecordingSPI::write(const Register *const buffer, uint8_t count) noexcept {
+	const auto	   result		  = spi.write(buffer, count);
+	const Register transferred[1u] = {result.value_or(0u)};
+	log(SPILog::Kind::WRITE, buffer, nullptr, count, result ? transferred : nullptr);
+	return result;
+}
+
+std::optional<std::tuple<uint8_t, uint8_t>> RecordingSPI::readWrite(
+	const Register *const txBuffer,
+	Register *const		  rxBuffer,
+	uint8_t				  count
+) noexcept {
+	const auto result		   = spi.readWrite(txBuffer, rxBuffer, count);
+	Register   transferred[2u] = {0u, 0u};
+	if (result) std::tie(transferred[0], transferred[1]) = *result;
+	log(SPILog::Kind::READ_WRITE, txBuffer, rxBuffer, count, result ? transferred : nullptr);
+	return result;
+}
+
+ReplaySPI::ReplaySPI(const Register *const log, std::size_t size) noexcept
+	: log(log),
+	  size(log == nullptr ? 0u : size),
+	  headerValid(
+		  this->size >= SPILog::HEADER_SIZE &&
+		  std::equal(SPILog::MAGIC.begin(), SPILog::MAGIC.end(), log) &&
+		  log[SPILog::MAGIC.size()] == SPILog::VERSION
+	  ),
+	  position(headerValid ? SPILog::HEADER_SIZE : this->size) {}
+
+void ReplaySPI::rewind(void) noexcept {
+	position   = headerValid ? SPILog::HEADER_SIZE : size;
+	transfers  = 0u;
+	divergence = std::nullopt;
+}
+
+void ReplaySPI::diverge(uint8_t offset, Register expected, Register actual) noexcept {
+	divergence = Mismatch{transfers, offset, expected, actual};
+}
+
+bool ReplaySPI::replay(
+	SPILog::Kind		  kind,
+	const Register *const txBuffer,
+	Register *const		  rxBuffer,
+	uint8_t				  count,
+	Register *const		  transferred
+) noexcept {
+	if (divergence) return false;
+
+	const Register kindByte = static_cast<Register>(kind);
+	if (size - position < REPLAY_ENTRY_HEADER) {
+		diverge(count, 0x00u, kindByte); // The log has ended
+		return false;
+	}
+
+	const Register logged		= log[position];
+	const uint8_t  loggedCount	= log[position + 1u];
+	const bool	   loggedFailed = (logged & SPILog::FAILED) != 0u;
+
+	const std::size_t length = REPLAY_ENTRY_HEADER + (loggedFailed ? 0u : transferredSize(kind)) +
+							   (hasTransmit(kind) ? count : 0u) +
+							   (hasReceive(kind) && !loggedFailed ? count : 0u);
+
+	if ((logged & ~SPILog::FAILED) != kindByte || loggedCount != count) {
+		diverge(count, logged, kindByte);
+		return false;
+	}
+	if (size - position < length) {
+		diverge(count, logged, kindByte); // Truncated entry
+		return false;
+	}
+
+	const Register *entry = &log[position + REPLAY_ENTRY_HEADER];
+	if (!loggedFailed) {
+		std::copy_n(entry, transferredSize(kind), transferred);
+		entry += transferredSize(kind);
+	}
+	if (hasTransmit(kind)) {
+		for (uint8_t i = 0u; i < count; i++) {
+			const Register actual = (txBuffer != nullptr) ? txBuffer[i] : Register{0x00u};
+			if (actual != entry[i]) {
+				diverge(i, entry[i], actual);
+				return false;
+			}
+		}
+		entry += count;
+	}
+
+	if (hasReceive(kind) && !loggedFailed && rxBuffer != nullptr) {
+		std::copy_n(entry, count, rxBuffer);
+	}
+
+	position += length;
+	transfers++;
+	return !loggedFailed;
+}
+
+std::optional<uint8_t> ReplaySPI::read(Register *const buffer, uint8_t count) noexcept {
+	Register transferred[1u];
+	if (!replay(SPILog::Kind::READ, nullptr, buffer, count, transferred)) return std::nullopt;
+	return transferred[0];
+}
+
+std::optional<uint8_t> ReplaySPI::write(const Register *const buffer, uint8_t count) noexcept {
+	Register transferred[1u];
+	if (!replay(SPILog::Kind::WRITE, buffer, nullptr, count, transferred)) return std::nullopt;
+	return transferred[0];
+}
+
+std::optional<std::tuple<uint8_t, uint8_t>> ReplaySPI::readWrite(
+	const Register *const txBuffer,
+	Register *const		  rxBuffer,
+	uint8_t				  count
+) noexcept {
+	Register transferred[2u];
+	if (!replay(SPILog::Kind::READ_WRITE, txBuffer, rxBuffer, count, transferred)) {
+		return std::nullopt;
+	}
+	return std::make_tuple(transferred[0], transferred[1]);
+}
@@ -0,0 +1,371 @@
+#include "ADS124S08.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using Simulator	   = ADS124S08::Simulator;
+using Register	   = ADS124S08::Register;
+using Address	   = ADS124S08::Address;
+using Command	   = ADS124S08::Command;
+using LatencyModel = ADS124S08::LatencyModel;
+using SPI		   = ADS124S08::SPI;
+using CRC8		   = ADS124S08::CRC8;
+
+static constexpr uint64_t SIMULATOR_NEVER		 = UINT64_MAX;
+static constexpr int32_t  SIMULATOR_CODE_MAX	 = 0x7FFFFF;
+static constexpr int32_t  SIMULATOR_CODE_MIN	 = -0x800000;
+static constexpr uint32_t SIMULATOR_UNITY_FSCAL	 = 0x400000u;
+static constexpr Register SIMULATOR_STATUS_POR	 = 0x80u;
+static constexpr Register SIMULATOR_STATUS_FLAGS = 0x7Fu; // Read-only flags
+
+// Number of conversions averaged by a calibration, indexed by SYS CAL_SAMP
+static constexpr std::array<uint32_t, 4u> SIMULATOR_CALIBRATION_SAMPLES = {1u, 4u, 8u, 16u};
+
+static int32_t saturate(int64_t code) noexcept {
+	return static_cast<int32_t>(std::clamp<int64_t>(code, SIMULATOR_CODE_MIN, SIMULATOR_CODE_MAX));
+}
+
+using RegisterFile = std::array<Register, ADS124S08::REGISTER_COUNT>;
+
+static uint32_t read24(const RegisterFile &registers, Address lsb) noexcept {
+	return (uint32_t{registers[lsb + 2u]} << 16u) | (uint32_t{registers[lsb + 1u]} << 8u) |
+		   registers[lsb];
+}
+
+static int32_t readOffset(const RegisterFile &registers) noexcept {
+	const int32_t offset = static_cast<int32_t>(read24(registers, Address::OF_CAL0));
+	return (offset & 0x800000) ? offset - 0x1000000 : offset; // Sign extend
+}
+
+static void write24(RegisterFile &registers, Address lsb, uint32_t value) noexcept {
+	registers[lsb]		= static_cast<Register>(value);
+	registers[lsb + 1u] = static_cast<Register>(value >> 8u);
+	registers[lsb + 2u] = static_cast<Register>(value >> 16u);
+}
+
+Simulator::Simulator(const Configuration &configuration) noexcept : configuration(configuration) {
+	reset();
+}
+
+void Simulator::setInput(Input input, void *context) noexcept {
+	this->input	 = input;
+	inputContext = context;
+}
+
+void Simulator::setDataReadyCallback(DataReadyCallback callback, void *context) noexcept {
+	dataReadyCallback = callback;
+	dataReadyContext  = context;
+}
+
+void Simulator::reset(void) noexcept {
+	registers			   = RESET_VALUES;
+	registers[Address::ID] = configuration.id;
+
+	running		= false;
+	continuous	= false;
+	calibrating = false;
+	newData		= false;
+	latest		= 0;
+}
+
+LatencyModel::Latency Simulator::latency(void) const noexcept {
+	return LatencyModel::compute(
+		ADS124S08::PGA{registers[Address::PGA]},
+		ADS124S08::DATARATE{registers[Address::DATA_RATE]}
+	);
+}
+
+void Simulator::restart(void) noexcept {
+	const ADS124S08::DATARATE datarate{registers[Address::DATA_RATE]};
+
+	running		   = true;
+	continuous	   = datarate.getConversionMode() == ADS124S08::DATARATE::ModeSelect::CONTINUOUS;
+	nextConversion = time + LatencyModel::nanoseconds(latency().firstSample, configuration.clockHz);
+	newData		   = false; // DRDY returns high
+}
+
+void Simulator::startCalibration(Command command) noexcept {
+	const ADS124S08::SYS sys{registers[Address::SYS]};
+	const auto			 timing = latency();
+	const uint32_t		 samples =
+		SIMULATOR_CALIBRATION_SAMPLES[static_cast<Register>(sys.getCalibrationSampleSize())];
+
+	resumeConversions = running || (calibrating && resumeConversions);
+	running			  = false;
+	calibrating		  = true;
+	calibration		  = command;
+	calibrationEnd	  = time + LatencyModel::nanoseconds(
+									timing.firstSample + (samples - 1u) * timing.period,
+									configuration.clockHz
+								);
+}
+
+float Simulator::sample(uint64_t nanoseconds) const noexcept {
+	if (input == nullptr) return 0.0f;
+	return input(inputContext, registers[Address::INP_MUX], nanoseconds);
+}
+
+int32_t Simulator::measure(uint64_t nanoseconds, bool shorted) const noexcept {
+	const ADS124S08::PGA	  pga{registers[Address::PGA]};
+	const ADS124S08::DATARATE datarate{registers[Address::DATA_RATE]};
+
+	// The SINC3 output settles over three data periods; model it as their average input
+	const uint8_t  periods = LatencyModel::settlingPeriods(datarate.getFilter());
+	const uint64_t period  = LatencyModel::nanoseconds(
+		 LatencyModel::decimationRatio(datarate.getDataRate()),
+		 configuration.clockHz
+	 );
+
+	float volts = 0.0f;
+	if (!shorted) {
+		for (uint8_t k = 0u; k < periods; k++) {
+			const uint64_t offset = k * period;
+			volts += sample(nanoseconds > offset ? nanoseconds - offset : 0u);
+		}
+		volts /= periods;
+	}
+	volts += configuration.offsetVolts;
+
+	const bool	 amplified = pga.getEnable() == ADS124S08::PGA::ENABLE::ENABLED;
+	const double gain = amplified ? double(1u << static_cast<Register>(pga.getGain())) : 1.0;
+	const double code = std::round(
+		double{volts} * gain / configuration.referenceVolts * (SIMULATOR_CODE_MAX + 1.0)
+	);
+	return saturate(static_cast<int64_t>(std::clamp(code, -1.0e9, 1.0e9)));
+}
+
+int32_t Simulator::calibrated(int32_t code) const noexcept {
+	const int64_t gain = read24(registers, Address::FS_CAL0);
+	return saturate((int64_t{code} - readOffset(registers)) * gain / SIMULATOR_UNITY_FSCAL);
+}
+
+void Simulator::completeConversion(void) noexcept {
+	latest = calibrated(measure(nextConversion, false));
+
+	if (newData) statistics.overruns++;
+	newData = true;
+	statistics.conversions++;
+
+	if (continuous) {
+		nextConversion += LatencyModel::nanoseconds(latency().period, configuration.clockHz);
+	} else running = false;
+
+	if (dataReadyCallback != nullptr) dataReadyCallback(dataReadyContext);
+}
+
+void Simulator::completeCalibration(void) noexcept {
+	calibrating = false;
+
+	switch (calibration) {
+	case SPI::CalibrationCommand::SELF_OFFSET_CAL:
+		write24(registers, Address::OF_CAL0, static_cast<uint32_t>(measure(calibrationEnd, true)));
+		break;
+
+	case SPI::CalibrationCommand::SYS_OFFSET_CAL:
+		write24(registers, Address::OF_CAL0, static_cast<uint32_t>(measure(calibrationEnd, false)));
+		break;
+
+	case SPI::CalibrationCommand::SYS_GAIN_CAL: {
+		// Scale the full-scale input applied to the full-scale code
+		const int64_t span = int64_t{measure(calibrationEnd, false)} - readOffset(registers);
+		if (span > 0) {
+			const int64_t gain = int64_t{SIMULATOR_CODE_MAX} * SIMULATOR_UNITY_FSCAL / span;
+			write24(registers, Address::FS_CAL0, uint32_t(std::min<int64_t>(gain, 0xFFFFFF)));
+		}
+		break;
+	}
+
+	default:
+		break;
+	}
+
+	if (resumeConversions) restart();
+	resumeConversions = false;
+}
+
+uint64_t Simulator::nextEvent(void) const noexcept {
+	uint64_t event = SIMULATOR_NEVER;
+	if (running) event = std::min(event, nextConversion);
+	if (calibrating) event = std::min(event, calibrationEnd);
+	return event;
+}
+
+void Simulator::advance(uint64_t nanoseconds) noexcept {
+	const uint64_t target = time + nanoseconds;
+
+	for (uint64_t event = nextEvent(); event <= target; event = nextEvent()) {
+		time = event;
+		if (calibrating && calibrationEnd == event) completeCalibration();
+		else completeConversion();
+	}
+	time = target;
+}
+
+bool Simulator::advanceToNextEvent(void) noexcept {
+	const uint64_t event = nextEvent();
+	if (event == SIMULATOR_NEVER) return false;
+
+	advance(event - time);
+	return true;
+}
+
+void Simulator::elapse(uint8_t bytes) noexcept {
+	if (configuration.sclkHz == 0u) return;
+	advance(uint64_t{bytes} * 8u * 1000000000u / configuration.sclkHz);
+}
+
+void Simulator::writeRegisters(
+	Address				  startAddress,
+	const Register *const values,
+	uint8_t				  count
+) noexcept {
+	bool reconfigured = false;
+
+	for (uint8_t i = 0u; i < count; i++) {
+		const uint8_t address = startAddress + i;
+		if (address >= REGISTER_COUNT) break;
+
+		switch (address) {
+		case Address::ID:
+			break; // Read-only
+
+		case Address::STATUS:
+			// Only FL_POR can be written, and only cleared
+			registers[address] &= static_cast<Register>(values[i] | SIMULATOR_STATUS_FLAGS);
+			break;
+
+		default:
+			registers[address] = values[i];
+			reconfigured |= address >= Address::INP_MUX && address <= Address::IDAC_MUX;
+			break;
+		}
+	}
+
+	// Writing the configuration registers restarts the conversion in progress
+	if (reconfigured && running) restart();
+}
+
+uint8_t Simulator::conversionFrame(Register *rx, uint8_t index, uint8_t count) noexcept {
+	const ADS124S08::SYS sys{registers[Address::SYS]};
+
+	Register frame[5u];
+	uint8_t	 length = 0u;
+
+	if (sys.sendStat()) frame[length++] = registers[Address::STATUS];
+	frame[length++] = static_cast<Register>(latest >> 16u);
+	frame[length++] = static_cast<Register>(latest >> 8u);
+	frame[length++] = static_cast<Register>(latest);
+	if (sys.crc()) {
+		frame[length] = CRC8::compute(frame, length);
+		length++;
+	}
+
+	const uint8_t available = std::min<uint8_t>(length, count - index);
+	if (rx != nullptr) std::copy_n(frame, available, &rx[index]);
+
+	newData = false;
+	return available;
+}
+
+uint8_t Simulator::command(
+	const Register *const tx,
+	Register *const		  rx,
+	uint8_t				  index,
+	uint8_t				  count
+) noexcept {
+	const Register opcode	 = (tx != nullptr) ? tx[index] : Register{SPI::ControlCommand::NOP};
+	const uint8_t  remaining = count - index;
+
+	// RREG and WREG: opcode, register count minus one, then the register bytes
+	if ((opcode & 0xE0u) == 0x20u || (opcode & 0xE0u) == 0x40u) {
+		const Address address = static_cast<Address>(opcode & 0x1Fu);
+		const uint8_t registersRequested =
+			(remaining > 1u && tx != nullptr) ? static_cast<uint8_t>(tx[index + 1u] + 1u) : 1u;
+		const uint8_t length = std::min<uint8_t>(2u + registersRequested, remaining);
+		const uint8_t transferred = length > 2u ? length - 2u : 0u;
+
+		if ((opcode & 0xE0u) == 0x20u) {
+			for (uint8_t i = 0u; i < transferred && rx != nullptr; i++) {
+				const uint8_t source = address + i;
+				rx[index + 2u + i]	 = source < REGISTER_COUNT ? registers[source] : 0x00u;
+			}
+		} else writeRegisters(address, &tx[index + 2u], transferred);
+
+		return length;
+	}
+
+	switch (opcode) {
+	case SPI::ControlCommand::NOP:
+		// NOPs clocked from the start of a transfer read the conversion directly
+		if (index == 0u && rx != nullptr) return conversionFrame(rx, index, count);
+		return 1u;
+
+	case SPI::DataReadCommand::RDATA:
+	case SPI::DataReadCommand::RDATA + 1u:
+		if (remaining == 1u) return 1u;
+		return 1u + conversionFrame(rx, index + 1u, count);
+
+	case SPI::ControlCommand::POWERDOWN:
+	case SPI::ControlCommand::POWERDOWN + 1u:
+		running		= false;
+		calibrating = false;
+		return 1u;
+
+	case SPI::ControlCommand::RESET:
+	case SPI::ControlCommand::RESET + 1u:
+		reset();
+		return 1u;
+
+	case SPI::ControlCommand::START:
+	case SPI::ControlCommand::START + 1u:
+		if (!calibrating) restart();
+		return 1u;
+
+	case SPI::ControlCommand::STOP:
+	case SPI::ControlCommand::STOP + 1u:
+		continuous = false; // The conversion in progress completes
+		return 1u;
+
+	case SPI::CalibrationCommand::SYS_OFFSET_CAL:
+	case SPI::CalibrationCommand::SYS_GAIN_CAL:
+	case SPI::CalibrationCommand::SELF_OFFSET_CAL:
+		startCalibration(opcode);
+		return 1u;
+
+	default:
+		return 1u; // WAKEUP and unknown opcodes
+	}
+}
+
+uint8_t Simulator::transfer(const Register *tx, Register *rx, uint8_t count) noexcept {
+	statistics.transfers++;
+	statistics.bytes += count;
+	if (rx != nullptr) std::fill_n(rx, count, 0x00u);
+
+	for (uint8_t index = 0u; index < count;) {
+		index += command(tx, rx, index, count);
+	}
+
+	elapse(count);
+	return count;
+}
+
+std::optional<uint8_t> Simulator::read(Register *const buffer, uint8_t count) noexcept {
+	if (buffer == nullptr) return std::nullopt;
+	return transfer(nullptr, buffer, count);
+}
+
+std::optional<uint8_t> Simulator::write(const Register *const buffer, uint8_t count) noexcept {
+	if (buffer == nullptr) return std::nullopt;
+	return transfer(buffer, nullptr, count);
+}
+
+std::optional<std::tuple<uint8_t, uint8_t>> Simulator::readWrite(
+	const Register *const txBuffer,
+	Register *const		  rxBuffer,
+	uint8_t				  count
+) noexcept {
+	if (txBuffer == nullptr || rxBuffer == nullptr) return std::nullopt;
+	transfer(txBuffer, rxBuffer, count);
+	return std::make_tuple(count, count);
+}
@@ -0,0 +1,119 @@
+#include "ADS124S08.hpp"
+
+#if defined(__linux__) && __has_include(<linux/spi/spidev.h>)
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+using SpidevSPI = ADS124S08::SpidevSPI;
+using Register	= ADS124S08::Register;
+
+int SpidevSPI::systemIoctl(int fd, unsigned long request, void *argument) noexcept {
+	return ::ioctl(fd, request, argument);
+}
+
+int SpidevSPI::open(const char *path, uint32_t speedHz, Ioctl ioctl) noexcept {
+	const int fd = ::open(path, O_RDWR | O_CLOEXEC);
+	if (fd < 0) return -1;
+
+	uint8_t mode = SPI_MODE_1; // CPOL = 0, CPHA = 1
+	uint8_t bits = 8u;
+
+	if (ioctl(fd, SPI_IOC_WR_MODE, &mode) < 0 || ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0 ||
+		ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &speedHz) < 0) {
+		::close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+bool SpidevSPI::enqueue(
+	const Register *txBuffer,
+	Register	   *rxBuffer,
+	uint8_t			count,
+	bool			copy
+) noexcept {
+	if (queued == MAX_SEGMENTS || (copy && txUsed + count > BUFFER_SIZE)) {
+		if (!submit()) return false;
+	}
+
+	deferred = deferred || copy;
+	if (copy && txBuffer != nullptr) {
+		Register *const stored = &txStorage[txUsed];
+		std::copy_n(txBuffer, count, stored);
+		txBuffer = stored;
+		txUsed += count;
+	}
+
+	spi_ioc_transfer &segment = queue[queued++];
+	segment					  = spi_ioc_transfer{};
+	segment.tx_buf			  = reinterpret_cast<uintptr_t>(txBuffer);
+	segment.rx_buf			  = reinterpret_cast<uintptr_t>(rxBuffer);
+	segment.len				  = count;
+	segment.speed_hz		  = speedHz;
+	segment.bits_per_word	  = 8u;
+	return true;
+}
+
+bool SpidevSPI::submit(void) noexcept {
+	if (queued == 0u) return true;
+
+	// Release the chip select between segments, each being a separate device transaction
+	for (uint8_t i = 0u; i < queued; i++) {
+		queue[i].cs_change = (i + 1u < queued) ? 1u : 0u;
+	}
+
+	const int result = ioctl(fd, SPI_IOC_MESSAGE(queued), queue.data());
+
+	// The driver cached the deferred writes when they were queued
+	if (result < 0 && deferred && driver != nullptr) {
+		driver->invalidateCachedRange(Address::ID, REGISTER_COUNT);
+	}
+
+	messages++;
+	queued	 = 0u;
+	txUsed	 = 0u;
+	deferred = false;
+	return result >= 0;
+}
+
+std::optional<uint8_t> SpidevSPI::read(Register *const buffer, uint8_t count) noexcept {
+	if (!enqueue(nullptr, buffer, count, false) || !submit()) return std::nullopt;
+	return count;
+}
+
+std::optional<uint8_t> SpidevSPI::write(const Register *const buffer, uint8_t count) noexcept {
+	if (!enqueue(buffer, nullptr, count, batching)) return std::nullopt;
+	if (!batching && !submit()) return std::nullopt;
+	return count;
+}
+
+std::optional<std::tuple<uint8_t, uint8_t>> SpidevSPI::readWrite(
+	const Register *const txBuffer,
+	Register *const		  rxBuffer,
+	uint8_t				  count
+) noexcept {
+	if (!enqueue(txBuffer, rxBuffer, count, false) || !submit()) return std::nullopt;
+	return std::make_tuple(count, count);
+}
+
+bool SpidevSPI::transfer(const Segment *const segments, uint8_t count) noexcept {
+	if (segments == nullptr || count > MAX_SEGMENTS) return false;
+
+	for (uint8_t i = 0u; i < count; i++) {
+		if (!enqueue(segments[i].txBuffer, segments[i].rxBuffer, segments[i].count, false)) {
+			return false;
+		}
+	}
+	return submit();
+}
+
+bool SpidevSPI::flush(void) noexcept {
+	batching = false;
+	return submit();
+}
+
+#endif
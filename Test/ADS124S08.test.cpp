@@ -53,13 +53,19 @@ public:
 		return count;
 	}
 
+	/**
+	 * @param misoOffset The number of leading don't-care bytes clocked out while command bytes
+	 * are clocked in, before the fake values.
+	 */
 	static std::optional<std::tuple<uint8_t, uint8_t>> fakeReadWrite(
 		const Register *const txBuffer,
 		Register *const		  rxBuffer,
 		uint8_t				  count,
-		Register const		 *fakeReadValues
+		Register const		 *fakeReadValues,
+		uint8_t				  misoOffset = 0u
 	) noexcept {
-		std::copy_n(fakeReadValues, count, rxBuffer);
+		std::fill_n(rxBuffer, misoOffset, 0xFFu);
+		std::copy_n(fakeReadValues, count - misoOffset, &rxBuffer[misoOffset]);
 		return std::make_tuple(count, count);
 	}
 };
@@ -85,7 +91,7 @@ public:
 		(noexcept, override)
 	);
 
-	void delegateToFakes(Register const *fakeReadValues) {
+	void delegateToFakes(Register const *fakeReadValues, uint8_t misoOffset = 0u) {
 		ON_CALL(*this, read(_, _))
 			.WillByDefault([this, fakeReadValues](Register *const buffer, uint8_t count) {
 				return FakeSPI::fakeRead(buffer, count, fakeReadValues);
@@ -95,12 +101,14 @@ public:
 				return FakeSPI::fakeWrite(buffer, count);
 			});
 		ON_CALL(*this, readWrite(_, _, _))
-			.WillByDefault([this, fakeReadValues](
+			.WillByDefault([this, fakeReadValues, misoOffset](
 							   const Register *const txBuffer,
 							   Register *const		 rxBuffer,
 							   uint8_t				 count
 						   ) {
-				return FakeSPI::fakeReadWrite(txBuffer, rxBuffer, count, fakeReadValues);
+				return FakeSPI::fakeReadWrite(
+					txBuffer, rxBuffer, count, fakeReadValues, misoOffset
+				);
 			});
 	}
 
@@ -201,16 +209,24 @@ constexpr RREG_TestCase const rregCases[] = {
 
 TEST_F(ADS124S08_Test, rregNormallyReadsExpectedValues) {
 	for (const auto &testCase : rregCases) {
-		mockSPI.delegateToFakes(testCase.expectedValues.data());
-
-		EXPECT_CALL(mockSPI, write(_, Eq(2u))).Times(1);
-		EXPECT_CALL(mockSPI, read(_, Eq(testCase.count))).Times(1);
-
-		/* This test assumes the readWrite interface method is not used.
-		If changed to readWrite, update the test, packing the necessary zero
-		bytes into the expectedValues array.
-		*/
-		EXPECT_CALL(mockSPI, readWrite(_, _, _)).Times(0);
+		// Registers are clocked out after the 2 command bytes
+		mockSPI.delegateToFakes(testCase.expectedValues.data(), 2u);
+
+		EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+		EXPECT_CALL(mockSPI, read(_, _)).Times(0);
+		EXPECT_CALL(mockSPI, readWrite(_, _, Eq(2u + testCase.count)))
+			.WillOnce([&testCase](
+						  const Register *const txBuffer,
+						  Register *const		rxBuffer,
+						  uint8_t				count
+					  ) {
+				EXPECT_EQ(txBuffer[0], 0x20u | testCase.address);
+				EXPECT_EQ(txBuffer[1], testCase.count - 1u);
+				for (uint8_t i = 2u; i < count; i++) EXPECT_EQ(txBuffer[i], ControlCommand::NOP);
+				return FakeSPI::fakeReadWrite(
+					txBuffer, rxBuffer, count, testCase.expectedValues.data(), 2u
+				);
+			});
 
 		Register readBuffer[testCase.count];
 
@@ -230,7 +246,7 @@ TEST_F(ADS124S08_Test, rregReturnsExpectedValueForSingleByteRead) {
 			continue; // Only test single-byte reads here
 		}
 
-		mockSPI.delegateToFakes(testCase.expectedValues.data());
+		mockSPI.delegateToFakes(testCase.expectedValues.data(), 2u);
 
 		auto result = adc.rreg(testCase.address);
 
@@ -405,11 +421,12 @@ TEST_F(ADS124S08_Test, setRegistersNormallySucceedsAndReturnsWrittenValue) {
 TEST_F(ADS124S08_Test, rdataNormallyReadsExpectedValues) {
 	std::array<Register, 3u> fakeData = {0x12u, 0x34u, 0x56u};
 
-	mockSPI.delegateToFakes(fakeData.data());
+	// Data is clocked out after the RDATA command byte
+	mockSPI.delegateToFakes(fakeData.data(), 1u);
 
-	EXPECT_CALL(mockSPI, write(_, Eq(1u))).Times(1);
-	EXPECT_CALL(mockSPI, read(_, Eq(3u))).Times(1);
-	EXPECT_CALL(mockSPI, readWrite(_, _, _)).Times(0);
+	EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, read(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, readWrite(_, _, Eq(4u))).Times(1);
 
 	auto result = adc.rdata();
 	EXPECT_TRUE(result.has_value());
@@ -421,11 +438,12 @@ TEST_F(ADS124S08_Test, rdataNormallyReadsExpectedValues) {
 TEST_F(ADS124S08_Test, rdataWithStatusReturnsExpectedValues) {
 	std::array<Register, 4u> fakeData = {0xABu, 0x12u, 0x34u, 0x56u};
 
-	mockSPI.delegateToFakes(fakeData.data());
+	// Data is clocked out after the RDATA command byte
+	mockSPI.delegateToFakes(fakeData.data(), 1u);
 
-	EXPECT_CALL(mockSPI, write(_, Eq(1u))).Times(1);
-	EXPECT_CALL(mockSPI, read(_, Eq(4u))).Times(1);
-	EXPECT_CALL(mockSPI, readWrite(_, _, _)).Times(0);
+	EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, read(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, readWrite(_, _, Eq(5u))).Times(1);
 
 	auto result = adc.rdata(true, false);
 	EXPECT_TRUE(result.has_value());
@@ -438,11 +456,12 @@ TEST_F(ADS124S08_Test, rdataWithStatusReturnsExpectedValues) {
 TEST_F(ADS124S08_Test, rdataWithCrcReturnsExpectedValues) {
 	std::array<Register, 4u> fakeData = {0x12u, 0x34u, 0x56u, 0xCDu};
 
-	mockSPI.delegateToFakes(fakeData.data());
+	// Data is clocked out after the RDATA command byte
+	mockSPI.delegateToFakes(fakeData.data(), 1u);
 
-	EXPECT_CALL(mockSPI, write(_, Eq(1u))).Times(1);
-	EXPECT_CALL(mockSPI, read(_, Eq(4u))).Times(1);
-	EXPECT_CALL(mockSPI, readWrite(_, _, _)).Times(0);
+	EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, read(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, readWrite(_, _, Eq(5u))).Times(1);
 
 	auto result = adc.rdata(false, true);
 	EXPECT_TRUE(result.has_value());
@@ -455,11 +474,12 @@ TEST_F(ADS124S08_Test, rdataWithCrcReturnsExpectedValues) {
 TEST_F(ADS124S08_Test, rdataWithStatusAndCrcReturnsExpectedValues) {
 	std::array<Register, 5u> fakeData = {0xABu, 0x12u, 0x34u, 0x56u, 0xCDu};
 
-	mockSPI.delegateToFakes(fakeData.data());
+	// Data is clocked out after the RDATA command byte
+	mockSPI.delegateToFakes(fakeData.data(), 1u);
 
-	EXPECT_CALL(mockSPI, write(_, Eq(1u))).Times(1);
-	EXPECT_CALL(mockSPI, read(_, Eq(5u))).Times(1);
-	EXPECT_CALL(mockSPI, readWrite(_, _, _)).Times(0);
+	EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, read(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, readWrite(_, _, Eq(6u))).Times(1);
 
 	auto result = adc.rdata(true, true);
 	EXPECT_TRUE(result.has_value());
@@ -477,14 +497,152 @@ TEST_F(ADS124S08_Test, rdataReturnsNulloptWhenSpiFails) {
 	EXPECT_FALSE(result.has_value());
 }
 
+TEST_F(ADS124S08_Test, rdataDirectUsesSingleReadWriteOfNops) {
+	const std::array<std::tuple<bool, bool, uint8_t>, 4u> frameLayouts = {{
+		{false, false, 3u},
+		{true, false, 4u},
+		{false, true, 4u},
+		{true, true, 5u},
+	}};
+
+	for (const auto &[statusByte, crcByte, length] : frameLayouts) {
+		std::array<Register, 5u> fakeData  = {0xABu, 0x12u, 0x34u, 0x56u, 0xCDu};
+		const Register			*frameData = statusByte ? &fakeData[0] : &fakeData[1];
+
+		mockSPI.delegateToFakes(frameData);
+
+		EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+		EXPECT_CALL(mockSPI, read(_, _)).Times(0);
+		EXPECT_CALL(mockSPI, readWrite(_, _, Eq(length)))
+			.WillOnce([frameData](
+						  const Register *const txBuffer,
+						  Register *const		rxBuffer,
+						  uint8_t				count
+					  ) {
+				for (uint8_t i = 0u; i < count; i++) EXPECT_EQ(ControlCommand::NOP, txBuffer[i]);
+				return FakeSPI::fakeReadWrite(txBuffer, rxBuffer, count, frameData);
+			});
+
+		auto result = adc.rdataDirect(statusByte, crcByte);
+		ASSERT_TRUE(result.has_value());
+		EXPECT_EQ(result->data, 0x123456u);
+		EXPECT_EQ(result->status.has_value(), statusByte);
+		EXPECT_EQ(result->crc.has_value(), crcByte);
+		if (statusByte) { EXPECT_EQ(result->status.value(), 0xABu); }
+		if (crcByte) { EXPECT_EQ(result->crc.value(), 0xCDu); }
+
+		::testing::Mock::VerifyAndClearExpectations(&mockSPI);
+	}
+}
+
+TEST_F(ADS124S08_Test, rdataDirectReturnsNulloptWhenSpiFails) {
+	mockSPI.disableSPI();
+
+	auto result = adc.rdataDirect();
+	EXPECT_FALSE(result.has_value());
+}
+
+TEST_F(ADS124S08_Test, rdataWithReadModeSelectsMethod) {
+	std::array<Register, 3u> fakeData = {0x12u, 0x34u, 0x56u};
+	mockSPI.delegateToFakes(fakeData.data());
+
+	EXPECT_CALL(mockSPI, readWrite(_, _, Eq(3u))).Times(1);
+	EXPECT_EQ(adc.rdata(ADS124S08::DataReadMode::DIRECT)->data, 0x123456u);
+
+	mockSPI.delegateToFakes(fakeData.data(), 1u);
+	EXPECT_CALL(mockSPI, readWrite(_, _, Eq(4u))).Times(1);
+	EXPECT_EQ(adc.rdata(ADS124S08::DataReadMode::COMMAND)->data, 0x123456u);
+}
+
+TEST_F(ADS124S08_Test, rdataBatchReadsConsecutiveConversionsIntoArrays) {
+	static constexpr size_t SAMPLE_COUNT = 4u;
+
+	mockSPI.delegateToFakes(nullptr);
+	adc.setSystemControl(ADS124S08::SYS(0x13u)); // STATUS and CRC enabled
+
+	uint8_t sample = 0u;
+	EXPECT_CALL(mockSPI, readWrite(_, _, Eq(6u)))
+		.Times(SAMPLE_COUNT)
+		.WillRepeatedly([&sample](
+							const Register *const txBuffer,
+							Register *const		  rxBuffer,
+							uint8_t				  count
+						) -> std::optional<std::tuple<uint8_t, uint8_t>> {
+			EXPECT_EQ(txBuffer[0], ADS124S08::SPI::DataReadCommand::RDATA);
+			const std::array<Register, 6u> frame = {0xFFu, sample, 0x00u, 0x01u, sample, 0xC0u};
+			std::copy(frame.begin(), frame.end(), rxBuffer);
+			sample++;
+			return std::make_tuple(count, count);
+		});
+
+	uint32_t data[SAMPLE_COUNT];
+	Register status[SAMPLE_COUNT];
+	Register crc[SAMPLE_COUNT];
+
+	const auto read = adc.rdataBatch({data, status, crc}, SAMPLE_COUNT);
+
+	EXPECT_EQ(read, SAMPLE_COUNT);
+	for (uint8_t i = 0u; i < SAMPLE_COUNT; i++) {
+		EXPECT_EQ(data[i], 0x000100u | i);
+		EXPECT_EQ(status[i], i);
+		EXPECT_EQ(crc[i], 0xC0u);
+	}
+}
+
+TEST_F(ADS124S08_Test, rdataBatchDirectModeReadsDataOnly) {
+	std::array<Register, 3u> fakeData = {0x12u, 0x34u, 0x56u};
+	mockSPI.delegateToFakes(fakeData.data());
+
+	EXPECT_CALL(mockSPI, readWrite(_, _, Eq(3u))).Times(2);
+
+	uint32_t data[2u];
+	Register status[2u] = {0xEEu, 0xEEu};
+
+	const auto read =
+		adc.rdataBatch({data, status, nullptr}, 2u, ADS124S08::DataReadMode::DIRECT);
+
+	EXPECT_EQ(read, 2u);
+	EXPECT_EQ(data[0], 0x123456u);
+	EXPECT_EQ(data[1], 0x123456u);
+	EXPECT_EQ(status[0], 0xEEu) << "STATUS disabled, array must be untouched";
+}
+
+TEST_F(ADS124S08_Test, rdataBatchWaitsBeforeEachRead) {
+	std::array<Register, 3u> fakeData = {0x12u, 0x34u, 0x56u};
+	mockSPI.delegateToFakes(fakeData.data(), 1u);
+
+	EXPECT_CALL(mockSPI, readWrite(_, _, _)).Times(3);
+
+	// Allow 3 conversions, then time out
+	int	 remaining = 3;
+	auto waitReady = [](void *context) noexcept { return (*static_cast<int *>(context))-- > 0; };
+
+	uint32_t data[5u];
+
+	const auto read = adc.rdataBatch(
+		{data}, 5u, ADS124S08::DataReadMode::COMMAND, waitReady, &remaining
+	);
+
+	EXPECT_EQ(read, 3u);
+}
+
+TEST_F(ADS124S08_Test, rdataBatchStopsWhenSpiFails) {
+	mockSPI.disableSPI();
+
+	uint32_t data[2u];
+
+	EXPECT_EQ(adc.rdataBatch({data}, 2u), 0u);
+	EXPECT_EQ(adc.rdataBatch({nullptr}, 2u), 0u);
+}
+
 TEST_F(ADS124S08_Test, getSystemControlNormallyReturnsExpectedValue) {
 	Register fakeSysRegValue = 0x5Au;
 
-	mockSPI.delegateToFakes(&fakeSysRegValue);
+	mockSPI.delegateToFakes(&fakeSysRegValue, 2u);
 
-	EXPECT_CALL(mockSPI, write(_, Eq(2u))).Times(1);
-	EXPECT_CALL(mockSPI, read(_, Eq(1u))).Times(1);
-	EXPECT_CALL(mockSPI, readWrite(_, _, _)).Times(0);
+	EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, read(_, _)).Times(0);
+	EXPECT_CALL(mockSPI, readWrite(_, _, Eq(3u))).Times(1);
 
 	auto result = adc.getSystemControl();
 	EXPECT_TRUE(result.has_value());
@@ -501,11 +659,11 @@ TEST_F(ADS124S08_Test, getSystemControlReturnsNulloptWhenSpiFails) {
 TEST_F(ADS124S08_Test, getSystemControlUpdatesSysCache) {
 	Register fakeSysRegValue = 0xA5u;
 
-	mockSPI.delegateToFakes(&fakeSysRegValue);
+	mockSPI.delegateToFakes(&fakeSysRegValue, 2u);
 
-	adc.sysCache = 0x00u; // Set to known value
+	adc.registerCache[Address::SYS] = 0x00u; // Set to known value
 	adc.getSystemControl();
-	EXPECT_EQ(adc.sysCache, fakeSysRegValue);
+	EXPECT_EQ(adc.registerCache[Address::SYS], fakeSysRegValue);
 }
 
 TEST_F(ADS124S08_Test, setSystemControlNormallyWritesExpectedValue) {
@@ -540,9 +698,270 @@ TEST_F(ADS124S08_Test, setSystemControlUpdatesSysCache) {
 
 	ADS124S08::SYS sysControl(fakeSysRegValue);
 
-	adc.sysCache = 0x00u; // Set to known value
+	adc.registerCache[Address::SYS] = 0x00u; // Set to known value
 	adc.setSystemControl(sysControl);
-	EXPECT_EQ(adc.sysCache, fakeSysRegValue);
+	EXPECT_EQ(adc.registerCache[Address::SYS], fakeSysRegValue);
+}
+
+static constexpr std::array<Register, ADS124S08::REGISTER_COUNT> resetRegisterValues = {
+	0x00u, 0x80u, 0x01u, 0x00u, 0x14u, 0x10u, 0x00u, 0xFFu, 0x00u,
+	0x10u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x40u, 0x00u, 0x00u,
+};
+
+class ADS124S08_CacheTest : public ::testing::Test {
+public:
+	::testing::NiceMock<MockSPI> mockSPI{};
+	std::unique_ptr<ADS124S08>	 adc;
+
+	void SetUp() override {
+		mockSPI.delegateToFakes(resetRegisterValues.data(), 2u);
+		adc = std::make_unique<ADS124S08>(mockSPI);
+	}
+};
+
+TEST_F(ADS124S08_Test, constructorPopulatesRegisterCacheWithSingleRead) {
+	MockSPI localSPI{};
+	localSPI.delegateToFakes(resetRegisterValues.data(), 2u);
+
+	EXPECT_CALL(localSPI, readWrite(_, _, Eq(2u + ADS124S08::REGISTER_COUNT))).Times(1);
+
+	ADS124S08 localADC{localSPI};
+
+	for (uint8_t address = 0u; address < ADS124S08::REGISTER_COUNT; address++) {
+		const auto cached = localADC.getCachedRegister(static_cast<Address>(address));
+		if (address == Address::ID || address == Address::STATUS || address == Address::GPIO_DATA) {
+			EXPECT_FALSE(cached.has_value()) << "Volatile register cached at " << +address;
+		} else {
+			ASSERT_TRUE(cached.has_value()) << "Register not cached at " << +address;
+			EXPECT_EQ(resetRegisterValues[address], cached.value());
+		}
+	}
+}
+
+TEST_F(ADS124S08_Test, constructorLeavesCacheInvalidWhenSpiFails) {
+	EXPECT_FALSE(adc.getCachedRegister(Address::SYS).has_value());
+	EXPECT_FALSE(adc.getCachedRegister(Address::INP_MUX).has_value());
+}
+
+TEST_F(ADS124S08_CacheTest, setRegisterElidesWriteWhenCachedValueMatches) {
+	EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+
+	auto result = adc->setRegister(ADS124S08::INPMUX(0x01u));
+
+	EXPECT_TRUE(result.has_value());
+	EXPECT_EQ(result.value(), 0x01u);
+	EXPECT_EQ(adc->getWriteStatistics().elidedWrites, 1u);
+	EXPECT_EQ(adc->getWriteStatistics().elidedBytes, 1u);
+	EXPECT_EQ(adc->getWriteStatistics().issuedWrites, 0u);
+}
+
+TEST_F(ADS124S08_CacheTest, setRegisterWritesAndCachesChangedValue) {
+	EXPECT_CALL(mockSPI, write(_, Eq(3u))).Times(1);
+
+	auto result = adc->setRegister(ADS124S08::INPMUX(0x23u));
+	EXPECT_TRUE(result.has_value());
+	EXPECT_EQ(adc->getCachedRegister(Address::INP_MUX), 0x23u);
+
+	// Repeating the same write is now elided
+	result = adc->setRegister(ADS124S08::INPMUX(0x23u));
+	EXPECT_TRUE(result.has_value());
+	EXPECT_EQ(adc->getWriteStatistics().issuedWrites, 1u);
+	EXPECT_EQ(adc->getWriteStatistics().elidedWrites, 1u);
+}
+
+TEST_F(ADS124S08_CacheTest, setRegisterThroughInterfaceMatchesStaticDispatch) {
+	const ADS124S08::INPMUX		 inpmux(0x23u);
+	const ADS124S08::SPI_Register_I &reg = inpmux;
+
+	EXPECT_CALL(mockSPI, write(_, Eq(3u))).Times(1);
+
+	EXPECT_EQ(adc->setRegister(reg), 0x23u);
+	EXPECT_EQ(adc->setRegister(inpmux), 0x23u); // Elided, as the cache now matches
+	EXPECT_EQ(adc->getWriteStatistics().elidedWrites, 1u);
+}
+
+TEST_F(ADS124S08_CacheTest, wregTrimsRegistersAlreadyCached) {
+	const std::array<Register, 4u> values = {0x01u, 0x00u, 0x15u, 0x10u};
+
+	EXPECT_CALL(mockSPI, write(_, Eq(3u)))
+		.WillOnce([](const Register *const buffer, uint8_t count) -> std::optional<uint8_t> {
+			EXPECT_EQ(buffer[0], 0x40u | Address::DATA_RATE);
+			EXPECT_EQ(buffer[1], 0x00u);
+			EXPECT_EQ(buffer[2], 0x15u);
+			return count;
+		});
+
+	auto result = adc->wreg(Address::INP_MUX, values.size(), values.data());
+
+	EXPECT_TRUE(result.has_value());
+	EXPECT_EQ(result.value(), 0x01u);
+	EXPECT_EQ(adc->getWriteStatistics().elidedBytes, 3u);
+	EXPECT_EQ(adc->getCachedRegister(Address::DATA_RATE), 0x15u);
+}
+
+TEST_F(ADS124S08_CacheTest, wregNeverElidesVolatileRegisters) {
+	EXPECT_CALL(mockSPI, write(_, Eq(3u))).Times(2);
+
+	adc->wreg(Address::STATUS, 0x00u);
+	adc->wreg(Address::STATUS, 0x00u);
+
+	EXPECT_FALSE(adc->getCachedRegister(Address::STATUS).has_value());
+}
+
+TEST_F(ADS124S08_CacheTest, wregFailureInvalidatesCachedRegisters) {
+	EXPECT_CALL(mockSPI, write(_, _)).WillOnce(Return(nullopt)).WillOnce(Return(3u));
+
+	EXPECT_FALSE(adc->wreg(Address::PGA, 0x0Au).has_value());
+	EXPECT_FALSE(adc->getCachedRegister(Address::PGA).has_value());
+
+	// The reset value must now be written, as the device state is unknown
+	EXPECT_TRUE(adc->wreg(Address::PGA, 0x00u).has_value());
+	EXPECT_EQ(adc->getCachedRegister(Address::PGA), 0x00u);
+}
+
+TEST_F(ADS124S08_CacheTest, calibrationInvalidatesCalibrationRegisters) {
+	const std::array<std::function<std::optional<Register>()>, 3u> calibrations = {
+		[&]() { return adc->offsetCalibrate(); },
+		[&]() { return adc->gainCalibrate(); },
+		[&]() { return adc->selfOffsetCalibrate(); },
+	};
+
+	for (const auto &calibrate : calibrations) {
+		adc->refreshRegisterCache();
+		ASSERT_TRUE(adc->getCachedRegister(Address::OF_CAL0).has_value());
+
+		calibrate();
+
+		for (uint8_t address = Address::OF_CAL0; address <= Address::FS_CAL2; address++) {
+			EXPECT_FALSE(adc->getCachedRegister(static_cast<Address>(address)).has_value());
+		}
+		EXPECT_TRUE(adc->getCachedRegister(Address::SYS).has_value());
+	}
+}
+
+TEST_F(ADS124S08_CacheTest, resetRestoresCachedResetValues) {
+	EXPECT_CALL(mockSPI, write(_, Eq(3u))).Times(1);
+	EXPECT_CALL(mockSPI, write(_, Eq(1u))).Times(1);
+	adc->wreg(Address::REF, 0x3Au);
+
+	adc->reset();
+
+	EXPECT_EQ(adc->getCachedRegister(Address::REF), 0x10u);
+	EXPECT_EQ(adc->getCachedRegister(Address::DATA_RATE), 0x14u);
+	EXPECT_FALSE(adc->getCachedRegister(Address::STATUS).has_value());
+}
+
+TEST_F(ADS124S08_CacheTest, invalidateRegisterCacheForcesNextWrite) {
+	EXPECT_CALL(mockSPI, write(_, Eq(3u))).Times(1);
+
+	adc->invalidateRegisterCache();
+	adc->setRegister(ADS124S08::INPMUX(0x01u));
+
+	EXPECT_EQ(adc->getWriteStatistics().elidedWrites, 0u);
+}
+
+TEST_F(ADS124S08_CacheTest, setRegistersCoalescesContiguousRegistersIntoOneBurst) {
+	EXPECT_CALL(mockSPI, write(_, Eq(6u)))
+		.WillOnce([](const Register *const buffer, uint8_t count) -> std::optional<uint8_t> {
+			const std::array<Register, 6u> expected = {0x42u, 0x03u, 0x23u, 0x0Au, 0x1Du, 0x1Au};
+			for (uint8_t i = 0u; i < count; i++) EXPECT_EQ(expected[i], buffer[i]);
+			return count;
+		});
+
+	const ADS124S08::INPMUX	  inpmux{0x23u};
+	const ADS124S08::PGA	  pga{0x0Au};
+	const ADS124S08::DATARATE datarate{0x1Du};
+	const ADS124S08::REF	  ref{0x1Au};
+
+	auto result = adc->setRegisters({inpmux, pga, datarate, ref});
+
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result.value(), 1u);
+	EXPECT_EQ(adc->getCachedRegister(Address::REF), 0x1Au);
+}
+
+TEST_F(ADS124S08_CacheTest, setRegistersBridgesGapsOfCachedRegisters) {
+	EXPECT_CALL(mockSPI, write(_, Eq(6u)))
+		.WillOnce([](const Register *const buffer, uint8_t count) -> std::optional<uint8_t> {
+			// PGA and DATARATE are rewritten with their cached reset values
+			const std::array<Register, 6u> expected = {0x42u, 0x03u, 0x23u, 0x00u, 0x14u, 0x1Au};
+			for (uint8_t i = 0u; i < count; i++) EXPECT_EQ(expected[i], buffer[i]);
+			return count;
+		});
+
+	const ADS124S08::INPMUX inpmux{0x23u};
+	const ADS124S08::REF	ref{0x1Au};
+
+	const ADS124S08::SPI_Register_I *const regs[] = {&ref, &inpmux};
+
+	auto result = adc->setRegisters(regs, 2u);
+
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result.value(), 1u);
+}
+
+TEST_F(ADS124S08_CacheTest, setRegistersSplitsBurstsAroundVolatileRegisters) {
+	class GPIOCON : public ADS124S08::SPI_Register_I {
+	public:
+		virtual Register toRegister(void) const override { return 0x05u; }
+		virtual Address	 getAddress(void) const override { return Address::GPIO_CON; }
+		virtual Register getResetValue(void) const override { return 0x00u; }
+	};
+
+	EXPECT_CALL(mockSPI, write(_, Eq(3u))).Times(2);
+
+	const ADS124S08::INPMUX inpmux{0x23u};
+	const GPIOCON			gpiocon{};
+
+	// GPIODAT is volatile, so cannot be bridged between INPMUX and GPIOCON
+	auto result = adc->setRegisters({inpmux, gpiocon});
+
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result.value(), 2u);
+}
+
+TEST_F(ADS124S08_Test, setRegistersSplitsBurstsAroundUnknownRegisters) {
+	mockSPI.delegateToFakes(nullptr);
+	EXPECT_CALL(mockSPI, write(_, Eq(3u))).Times(2);
+
+	const ADS124S08::INPMUX	  inpmux{0x23u};
+	const ADS124S08::DATARATE datarate{0x1Du};
+
+	auto result = adc.setRegisters({inpmux, datarate});
+
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result.value(), 2u);
+}
+
+TEST_F(ADS124S08_CacheTest, setRegistersSkipsUnchangedRegisters) {
+	EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+
+	const ADS124S08::INPMUX	  inpmux{};
+	const ADS124S08::DATARATE datarate{};
+
+	auto result = adc->setRegisters({inpmux, datarate});
+
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result.value(), 0u);
+	EXPECT_EQ(adc->getWriteStatistics().elidedWrites, 1u);
+	EXPECT_EQ(adc->getWriteStatistics().elidedBytes, 2u);
+}
+
+TEST_F(ADS124S08_CacheTest, setRegistersReturnsNulloptWhenSpiFails) {
+	mockSPI.disableSPI();
+
+	const ADS124S08::INPMUX inpmux{0x23u};
+
+	EXPECT_FALSE(adc->setRegisters({inpmux}).has_value());
+}
+
+TEST_F(ADS124S08_Test, setRegistersChecksForNullptr) {
+	EXPECT_CALL(mockSPI, write(_, _)).Times(0);
+
+	const ADS124S08::SPI_Register_I *const regs[] = {nullptr};
+
+	EXPECT_FALSE(adc.setRegisters(nullptr, 1u).has_value());
+	EXPECT_FALSE(adc.setRegisters(regs, 1u).has_value());
 }
 
 TEST(ADS124S08_RDATA_Test, toVoltageCalculatesExpectedVoltage) {
@@ -0,0 +1,212 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <vector>
+
+using Register		   = ADS124S08::Register;
+using Address		   = ADS124S08::Address;
+using AsyncTransaction = ADS124S08::AsyncTransaction;
+using State			   = AsyncTransaction::State;
+
+/**
+ * @brief Synchronous SPI used to construct the driver. All registers read as zero.
+ */
+class ZeroSPI final : public ADS124S08::SPI {
+public:
+	std::optional<uint8_t> read(Register *const, uint8_t count) noexcept override { return count; }
+
+	std::optional<uint8_t> write(const Register *const, uint8_t count) noexcept override {
+		return count;
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const, Register *const rxBuffer, uint8_t count) noexcept override {
+		std::fill_n(rxBuffer, count, 0u);
+		return std::make_tuple(count, count);
+	}
+};
+
+/**
+ * @brief Asynchronous SPI which queues transfers until the test completes them, like a DMA
+ * transport whose interrupt has not fired yet.
+ */
+class QueuedAsyncSPI final : public ADS124S08::AsyncSPI {
+public:
+	struct Transfer {
+		std::vector<Register> tx;
+		Register			 *rxBuffer;
+		Completion			  completion;
+		void				 *context;
+	};
+
+	std::vector<Transfer> queue{};
+	bool				  busy{false};
+
+	bool transfer(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count,
+		Completion			  completion,
+		void				 *context
+	) noexcept override {
+		if (busy) return false;
+		queue.push_back({{txBuffer, txBuffer + count}, rxBuffer, completion, context});
+		return true;
+	}
+
+	/**
+	 * @brief Complete the oldest queued transfer, clocking in `rx` if it is received.
+	 */
+	void complete(const std::vector<Register> &rx, bool success = true) {
+		Transfer transfer = queue.front();
+		queue.erase(queue.begin());
+		if (transfer.rxBuffer != nullptr) std::copy(rx.begin(), rx.end(), transfer.rxBuffer);
+		transfer.completion(transfer.context, success);
+	}
+};
+
+class AsyncSPI_Test : public ::testing::Test {
+public:
+	ZeroSPI		   spi{};
+	QueuedAsyncSPI asyncSpi{};
+	ADS124S08	   adc{spi};
+
+	AsyncTransaction transactions[2u]{};
+};
+
+TEST_F(AsyncSPI_Test, rdataReturnsBeforeTransferCompletes) {
+	ASSERT_TRUE(adc.rdataAsync(asyncSpi, transactions[0]));
+
+	ASSERT_EQ(asyncSpi.queue.size(), 1u);
+	EXPECT_EQ(asyncSpi.queue[0].tx, (std::vector<Register>{0x12u, 0x00u, 0x00u, 0x00u}));
+	EXPECT_TRUE(transactions[0].pending());
+	EXPECT_FALSE(transactions[0].conversion().has_value());
+
+	// A pending transaction may not be restarted
+	EXPECT_FALSE(adc.rdataAsync(asyncSpi, transactions[0]));
+
+	asyncSpi.complete({0xFFu, 0x12u, 0x34u, 0x56u});
+	EXPECT_EQ(transactions[0].state(), State::COMPLETED);
+
+	const auto result = transactions[0].conversion();
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result->data, 0x123456u);
+	EXPECT_FALSE(result->status.has_value());
+}
+
+TEST_F(AsyncSPI_Test, doubleBufferedReadsOverlapDecoding) {
+	ASSERT_TRUE(adc.rdataAsync(asyncSpi, transactions[0], ADS124S08::DataReadMode::DIRECT));
+	asyncSpi.complete({0x00u, 0x00u, 0x01u});
+
+	// The next read is in flight while the previous one is decoded
+	ASSERT_TRUE(adc.rdataAsync(asyncSpi, transactions[1], ADS124S08::DataReadMode::DIRECT));
+	EXPECT_EQ(asyncSpi.queue[0].tx, (std::vector<Register>{0x00u, 0x00u, 0x00u}));
+	EXPECT_EQ(transactions[0].conversion()->data, 0x000001u);
+
+	asyncSpi.complete({0x00u, 0x00u, 0x02u});
+	EXPECT_EQ(transactions[1].conversion()->data, 0x000002u);
+}
+
+TEST_F(AsyncSPI_Test, completionCallbackReceivesContext) {
+	struct Record {
+		int	 calls{0};
+		bool success{false};
+	} record;
+
+	const auto callback = [](void *context, bool success) noexcept {
+		auto *const record = static_cast<Record *>(context);
+		record->calls++;
+		record->success = success;
+	};
+
+	ASSERT_TRUE(adc.rdataAsync(
+		asyncSpi, transactions[0], ADS124S08::DataReadMode::COMMAND, callback, &record
+	));
+	EXPECT_EQ(record.calls, 0);
+
+	asyncSpi.complete({}, false);
+	EXPECT_EQ(record.calls, 1);
+	EXPECT_FALSE(record.success);
+	EXPECT_EQ(transactions[0].state(), State::FAILED);
+	EXPECT_FALSE(transactions[0].conversion().has_value());
+}
+
+TEST_F(AsyncSPI_Test, rregUpdatesCacheOnCompletion) {
+	ASSERT_TRUE(adc.rregAsync(asyncSpi, transactions[0], Address::INP_MUX, 2u));
+	EXPECT_EQ(asyncSpi.queue[0].tx, (std::vector<Register>{0x22u, 0x01u, 0x00u, 0x00u}));
+	EXPECT_EQ(transactions[0].registers(), nullptr);
+
+	asyncSpi.complete({0xFFu, 0xFFu, 0x23u, 0x0Au});
+	ASSERT_NE(transactions[0].registers(), nullptr);
+	EXPECT_EQ(transactions[0].registers()[1], 0x0Au);
+
+	EXPECT_EQ(adc.completeAsync(transactions[0]), 0x23u);
+	EXPECT_EQ(adc.getCachedRegister(Address::INP_MUX), 0x23u);
+	EXPECT_EQ(adc.getCachedRegister(Address::PGA), 0x0Au);
+}
+
+TEST_F(AsyncSPI_Test, wregInvalidatesCacheUntilCompletion) {
+	const Register values[2u] = {0x23u, 0x0Au};
+
+	ASSERT_TRUE(adc.wregAsync(asyncSpi, transactions[0], Address::INP_MUX, 2u, values));
+	EXPECT_EQ(asyncSpi.queue[0].tx, (std::vector<Register>{0x42u, 0x01u, 0x23u, 0x0Au}));
+	EXPECT_EQ(asyncSpi.queue[0].rxBuffer, transactions[0].rxFrame.data());
+	EXPECT_FALSE(adc.getCachedRegister(Address::INP_MUX).has_value());
+
+	// Not applied before the transfer completes
+	EXPECT_FALSE(adc.completeAsync(transactions[0]).has_value());
+
+	asyncSpi.complete({});
+	EXPECT_EQ(adc.completeAsync(transactions[0]), 0x23u);
+	EXPECT_EQ(adc.getCachedRegister(Address::PGA), 0x0Au);
+	EXPECT_EQ(adc.getWriteStatistics().issuedWrites, 1u);
+}
+
+TEST_F(AsyncSPI_Test, completionIsAppliedOnce) {
+	const Register value = 0x23u;
+
+	ASSERT_TRUE(adc.wregAsync(asyncSpi, transactions[0], Address::INP_MUX, 1u, &value));
+	asyncSpi.complete({});
+
+	EXPECT_EQ(adc.completeAsync(transactions[0]), 0x23u);
+	EXPECT_EQ(adc.completeAsync(transactions[0]), 0x23u);
+	EXPECT_EQ(adc.getWriteStatistics().issuedWrites, 1u);
+}
+
+TEST_F(AsyncSPI_Test, resetRestoresCacheOnCompletion) {
+	const Register value = 0x23u;
+	ASSERT_TRUE(adc.wreg(Address::INP_MUX, value));
+
+	ASSERT_TRUE(adc.commandAsync(asyncSpi, transactions[0], ADS124S08::SPI::ControlCommand::RESET));
+	EXPECT_FALSE(adc.getCachedRegister(Address::INP_MUX).has_value());
+
+	asyncSpi.complete({});
+	EXPECT_EQ(adc.completeAsync(transactions[0]), ADS124S08::SPI::ControlCommand::RESET);
+	EXPECT_EQ(adc.getCachedRegister(Address::INP_MUX), 0x01u); // Reset values
+	EXPECT_EQ(adc.getCachedRegister(Address::DATA_RATE), 0x14u);
+
+	// Writing the pre-reset value again must reach the device
+	const auto writes = adc.getWriteStatistics().issuedWrites;
+	ASSERT_TRUE(adc.wreg(Address::INP_MUX, value));
+	EXPECT_EQ(adc.getWriteStatistics().issuedWrites, writes + 1u);
+}
+
+TEST_F(AsyncSPI_Test, rejectsInvalidRequests) {
+	EXPECT_FALSE(adc.rregAsync(asyncSpi, transactions[0], Address::SYS, 0u));
+	EXPECT_FALSE(adc.rregAsync(asyncSpi, transactions[0], Address::GPIO_CON, 2u));
+	EXPECT_FALSE(adc.wregAsync(asyncSpi, transactions[0], Address::INP_MUX, 1u, nullptr));
+	EXPECT_TRUE(asyncSpi.queue.empty());
+	EXPECT_EQ(transactions[0].state(), State::IDLE);
+}
+
+TEST_F(AsyncSPI_Test, busyTransportFailsTransaction) {
+	asyncSpi.busy = true;
+
+	EXPECT_FALSE(adc.rdataAsync(asyncSpi, transactions[0]));
+	EXPECT_EQ(transactions[0].state(), State::FAILED);
+
+	// A failed transaction may be reused
+	asyncSpi.busy = false;
+	EXPECT_TRUE(adc.rdataAsync(asyncSpi, transactions[0]));
+}
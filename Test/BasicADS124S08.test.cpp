@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <type_traits>
+#include <vector>
+
+using Register = ADS124S08::Register;
+using Address  = ADS124S08::Address;
+
+/**
+ * @brief Transport without any virtual methods. Registers read as their address, conversions
+ * as 0x123456.
+ */
+struct InlineTransport {
+	std::vector<std::vector<Register>> transactions{};
+	bool							   fail{false};
+
+	std::optional<uint8_t> read(Register *const, uint8_t) noexcept { return std::nullopt; }
+
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept {
+		if (fail) return std::nullopt;
+		transactions.emplace_back(buffer, buffer + count);
+		return count;
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const txBuffer, Register *const rxBuffer, uint8_t count) noexcept {
+		if (fail) return std::nullopt;
+		transactions.emplace_back(txBuffer, txBuffer + count);
+
+		if ((txBuffer[0] & 0xE0u) == 0x20u) {
+			for (uint8_t i = 2u; i < count; i++) {
+				rxBuffer[i] = static_cast<Register>((txBuffer[0] & 0x1Fu) + i - 2u);
+			}
+		} else {
+			const bool	  command = txBuffer[0] == ADS124S08::SPI::DataReadCommand::RDATA;
+			const uint8_t offset  = command ? 1u : 0u;
+			rxBuffer[offset]	  = 0x12u;
+			rxBuffer[offset + 1u] = 0x34u;
+			rxBuffer[offset + 2u] = 0x56u;
+		}
+		return std::make_tuple(count, count);
+	}
+};
+
+static_assert(!std::is_polymorphic_v<InlineTransport>);
+static_assert(std::is_base_of_v<ADS124S08, BasicADS124S08<InlineTransport>>);
+
+class BasicADS124S08_Test : public ::testing::Test {
+public:
+	InlineTransport					transport{};
+	BasicADS124S08<InlineTransport> adc{transport};
+};
+
+TEST_F(BasicADS124S08_Test, constructorPopulatesCacheThroughAdapter) {
+	ASSERT_EQ(transport.transactions.size(), 1u);
+	EXPECT_EQ(transport.transactions[0][0], 0x20u); // RREG from address 0
+	EXPECT_EQ(adc.getCachedRegister(Address::SYS), static_cast<Register>(Address::SYS));
+}
+
+TEST_F(BasicADS124S08_Test, rdataCallsTransportDirectly) {
+	const auto result = adc.rdata(false, false);
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result->data, 0x123456u);
+	EXPECT_EQ(transport.transactions.back(), (std::vector<Register>{0x12u, 0x00u, 0x00u, 0x00u}));
+
+	const auto direct = adc.rdataDirect(false, false);
+	ASSERT_TRUE(direct.has_value());
+	EXPECT_EQ(direct->data, 0x123456u);
+	EXPECT_EQ(transport.transactions.back().size(), 3u);
+}
+
+TEST_F(BasicADS124S08_Test, wregSharesRegisterCacheWithBase) {
+	const ADS124S08::INPMUX inpmux{0x23u};
+
+	EXPECT_EQ(adc.setRegister(inpmux), 0x23u);
+	EXPECT_EQ(transport.transactions.back(), (std::vector<Register>{0x42u, 0x00u, 0x23u}));
+
+	// Elided by the cache, whichever path is used
+	const ADS124S08 &base = adc;
+	EXPECT_EQ(base.setRegister(inpmux), 0x23u);
+	EXPECT_EQ(adc.getWriteStatistics().issuedWrites, 1u);
+	EXPECT_EQ(adc.getWriteStatistics().elidedWrites, 1u);
+}
+
+TEST_F(BasicADS124S08_Test, rdataBatchReadsIntoArrays) {
+	adc.setSystemControl(ADS124S08::SYS{}); // No STATUS or CRC bytes
+
+	uint32_t data[3u] = {0u};
+	EXPECT_EQ(adc.rdataBatch({data}, 3u, ADS124S08::DataReadMode::DIRECT), 3u);
+	EXPECT_EQ(data[2], 0x123456u);
+}
+
+TEST_F(BasicADS124S08_Test, failuresAreReported) {
+	transport.fail = true;
+
+	EXPECT_FALSE(adc.start().has_value());
+	EXPECT_FALSE(adc.rdata().has_value());
+	EXPECT_FALSE(adc.rreg(Address::PGA).has_value());
+	EXPECT_FALSE(adc.reset().has_value()); // Through the adapter
+}
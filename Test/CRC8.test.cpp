@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <vector>
+
+using Register = ADS124S08::Register;
+using CRC8	   = ADS124S08::CRC8;
+using RDATA	   = ADS124S08::RDATA;
+using Backend  = CRC8::Backend;
+
+static constexpr Backend BACKENDS[] = {Backend::BITWISE, Backend::TABLE, Backend::SLICING_BY_4};
+
+static std::vector<Register> makeTestBytes(std::size_t length) {
+	std::vector<Register> bytes;
+	for (std::size_t i = 0u; i < length; i++) {
+		bytes.push_back(static_cast<Register>((i * 0x9Du + 0x3Bu) ^ (i >> 3u)));
+	}
+	return bytes;
+}
+
+TEST(CRC8_Test, backendsMatchStandardCheckValue) {
+	// CRC-8/SMBUS shares the polynomial, with a zero preset
+	const std::string check = "123456789";
+	const auto		  data	= reinterpret_cast<const Register *>(check.data());
+
+	for (const auto backend : BACKENDS) {
+		EXPECT_EQ(CRC8::compute(data, check.size(), backend, 0x00u), 0xF4u);
+	}
+}
+
+TEST(CRC8_Test, emptyBufferReturnsInitialValue) {
+	for (const auto backend : BACKENDS) {
+		EXPECT_EQ(CRC8::compute(nullptr, 0u, backend), CRC8::INITIAL_VALUE);
+	}
+}
+
+TEST(CRC8_Test, backendsAgreeForAllLengths) {
+	const auto bytes = makeTestBytes(37u);
+
+	for (std::size_t length = 0u; length <= bytes.size(); length++) {
+		for (const Register initial : {Register{0x00u}, Register{0xFFu}, Register{0x5Au}}) {
+			const Register expected = CRC8::bitwise(bytes.data(), length, initial);
+			EXPECT_EQ(CRC8::table(bytes.data(), length, initial), expected);
+			EXPECT_EQ(CRC8::slicing(bytes.data(), length, initial), expected);
+		}
+	}
+}
+
+TEST(CRC8_Test, appendedCrcLeavesZeroRemainder) {
+	auto bytes = makeTestBytes(4u);
+	bytes.push_back(CRC8::compute(bytes.data(), bytes.size()));
+
+	EXPECT_EQ(CRC8::compute(bytes.data(), bytes.size()), 0x00u);
+}
+
+TEST(CRC8_Test, crcValidChecksStatusAndData) {
+	const Register frame[] = {0x80u, 0x12u, 0x34u, 0x56u};
+
+	RDATA rdata{0x80u, 0x123456u, CRC8::compute(frame, 4u)};
+	EXPECT_EQ(rdata.crcValid(), true);
+
+	rdata.data ^= 0x000100u;
+	EXPECT_EQ(rdata.crcValid(), false);
+
+	rdata.crc = std::nullopt;
+	EXPECT_EQ(rdata.crcValid(), std::nullopt);
+}
+
+TEST(CRC8_Test, crcValidChecksDataOnlyWithoutStatus) {
+	const Register frame[] = {0x12u, 0x34u, 0x56u};
+
+	const RDATA rdata{std::nullopt, 0x123456u, CRC8::compute(frame, 3u)};
+	EXPECT_EQ(rdata.crcValid(), true);
+}
+
+TEST(CRC8_Test, verifyFramesCountsFailures) {
+	constexpr std::size_t FRAME_LENGTH = 5u;
+	constexpr std::size_t COUNT		   = 9u;
+
+	auto frames = makeTestBytes(FRAME_LENGTH * COUNT);
+	for (std::size_t i = 0u; i < COUNT; i++) {
+		Register *const frame	  = &frames[i * FRAME_LENGTH];
+		frame[FRAME_LENGTH - 1u] = CRC8::compute(frame, FRAME_LENGTH - 1u);
+	}
+	frames[2u * FRAME_LENGTH + 1u] ^= 0x01u;
+	frames[7u * FRAME_LENGTH + 4u] ^= 0x80u;
+
+	for (const auto backend : BACKENDS) {
+		bool results[COUNT];
+		EXPECT_EQ(CRC8::verifyFrames(frames.data(), FRAME_LENGTH, COUNT, results, backend), 2u);
+		for (std::size_t i = 0u; i < COUNT; i++) {
+			EXPECT_EQ(results[i], i != 2u && i != 7u);
+		}
+	}
+}
+
+TEST(CRC8_Test, verifyBatchMatchesPerConversionCheck) {
+	constexpr std::size_t COUNT = 6u;
+
+	uint32_t data[COUNT];
+	Register status[COUNT];
+	Register crc[COUNT];
+	for (std::size_t i = 0u; i < COUNT; i++) {
+		data[i]				   = (i * 0x0A3F1Bu) & 0xFFFFFFu;
+		status[i]			   = static_cast<Register>(0x80u | i);
+		const Register frame[] = {
+			status[i],
+			static_cast<Register>(data[i] >> 16u),
+			static_cast<Register>(data[i] >> 8u),
+			static_cast<Register>(data[i]),
+		};
+		crc[i] = CRC8::compute(frame, 4u);
+	}
+	crc[3u] ^= 0x10u;
+
+	const ADS124S08::RDATABatch batch{data, status, crc};
+
+	bool results[COUNT];
+	EXPECT_EQ(CRC8::verifyBatch(batch, COUNT, true, results), 1u);
+	for (std::size_t i = 0u; i < COUNT; i++) {
+		EXPECT_EQ(results[i], i != 3u);
+		EXPECT_EQ(results[i], RDATA({status[i], data[i], crc[i]}).crcValid());
+	}
+
+	// Without STATUS, the CRCs above no longer apply
+	EXPECT_EQ(CRC8::verifyBatch(batch, COUNT, false), COUNT);
+}
+
+TEST(CRC8_Test, verifyBatchRejectsMissingArrays) {
+	uint32_t data[1u] = {};
+	Register crc[1u]  = {};
+
+	EXPECT_EQ(CRC8::verifyBatch({data, nullptr, nullptr}, 1u, false), 1u);
+	EXPECT_EQ(CRC8::verifyBatch({data, nullptr, crc}, 1u, true), 1u);
+}
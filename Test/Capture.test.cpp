@@ -0,0 +1,272 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <string>
+#include <vector>
+
+using Register		= ADS124S08::Register;
+using Address		= ADS124S08::Address;
+using CaptureHeader = ADS124S08::CaptureHeader;
+using CaptureWriter = ADS124S08::CaptureWriter;
+using CaptureView	= ADS124S08::CaptureView;
+
+/**
+ * @brief Sink appending to a byte vector, failing once `limit` bytes were written.
+ */
+struct MemorySink {
+	std::vector<Register> bytes{};
+	std::size_t			  limit{SIZE_MAX};
+	uint32_t			  writes{0u};
+
+	static bool write(void *context, const Register *data, std::size_t count) noexcept {
+		auto *const sink = static_cast<MemorySink *>(context);
+		if (sink->bytes.size() + count > sink->limit) return false;
+		sink->bytes.insert(sink->bytes.end(), data, data + count);
+		sink->writes++;
+		return true;
+	}
+};
+
+static CaptureHeader makeHeader(bool statusByte, bool crcByte) {
+	CaptureHeader header{};
+	header.registers		= ADS124S08::RESET_VALUES;
+	header.statusByte		= statusByte;
+	header.crcByte			= crcByte;
+	header.startNanoseconds = 0x0123456789ABCDEFu;
+	header.registersValid	= 0x0002FFFCu;
+	return header;
+}
+
+static ADS124S08::RDATA conversion(uint32_t data) {
+	const Register frame[4u] = {
+		0x00u,
+		static_cast<Register>(data >> 16u),
+		static_cast<Register>(data >> 8u),
+		static_cast<Register>(data),
+	};
+	return ADS124S08::RDATA{0x00u, data, ADS124S08::CRC8::compute(frame, 4u)};
+}
+
+TEST(CaptureHeader_Test, roundTrips) {
+	const CaptureHeader header = makeHeader(true, true);
+
+	Register buffer[CaptureHeader::SIZE];
+	header.serialize(buffer);
+	EXPECT_EQ(buffer[13], 5u);
+
+	const auto parsed = CaptureHeader::parse(buffer, sizeof(buffer));
+	ASSERT_TRUE(parsed);
+	EXPECT_EQ(parsed->registers, header.registers);
+	EXPECT_TRUE(parsed->statusByte);
+	EXPECT_TRUE(parsed->crcByte);
+	EXPECT_EQ(parsed->clockHz, header.clockHz);
+	EXPECT_EQ(parsed->startNanoseconds, header.startNanoseconds);
+	EXPECT_EQ(parsed->registersValid, header.registersValid);
+}
+
+TEST(CaptureHeader_Test, rejectsInvalidHeaders) {
+	Register buffer[CaptureHeader::SIZE];
+	makeHeader(false, false).serialize(buffer);
+
+	EXPECT_FALSE(CaptureHeader::parse(buffer, CaptureHeader::SIZE - 1u));
+
+	buffer[0] = 'X';
+	EXPECT_FALSE(CaptureHeader::parse(buffer, sizeof(buffer)));
+	buffer[0] = 'A';
+
+	buffer[13] = 4u; // Record size inconsistent with the flags
+	EXPECT_FALSE(CaptureHeader::parse(buffer, sizeof(buffer)));
+}
+
+TEST(CaptureHeader_Test, fromDriverSnapshotsRegisters) {
+	ADS124S08::Simulator simulator{};
+	ADS124S08			 adc{simulator};
+	ASSERT_TRUE(adc.setRegister(ADS124S08::SYS{}.setSendStatus(true)));
+	ASSERT_TRUE(adc.setRegister(ADS124S08::INPMUX{0x23u}));
+
+	const auto header = CaptureHeader::fromDriver(adc, 42u);
+	EXPECT_TRUE(header.statusByte);
+	EXPECT_FALSE(header.crcByte);
+	EXPECT_EQ(header.registers[Address::INP_MUX], 0x23u);
+	EXPECT_EQ(header.registers[Address::DATA_RATE], ADS124S08::RESET_VALUES[Address::DATA_RATE]);
+	EXPECT_EQ(header.startNanoseconds, 42u);
+}
+
+TEST(CaptureHeader_Test, fromDriverOmitsUnknownRegisters) {
+	ADS124S08::Simulator simulator{};
+	ADS124S08			 adc{simulator};
+	ASSERT_TRUE(adc.reset());
+	ASSERT_TRUE(adc.selfOffsetCalibrate());
+
+	const auto header = CaptureHeader::fromDriver(adc);
+	const auto known  = [&header](Address address) {
+		return (header.registersValid & (1u << address)) != 0u;
+	};
+	EXPECT_FALSE(known(Address::ID));
+	EXPECT_FALSE(known(Address::STATUS));
+	EXPECT_FALSE(known(Address::GPIO_DATA));
+	EXPECT_FALSE(known(Address::OF_CAL0));
+	EXPECT_FALSE(known(Address::FS_CAL2));
+	EXPECT_EQ(header.registers[Address::FS_CAL2], 0x00u);
+	EXPECT_TRUE(known(Address::SYS));
+	EXPECT_TRUE(known(Address::GPIO_CON));
+}
+
+TEST(CaptureWriter_Test, writesRecordsReadBackByView) {
+	MemorySink	  sink{};
+	CaptureWriter writer{MemorySink::write, &sink};
+
+	ASSERT_TRUE(writer.begin(makeHeader(true, true)));
+	ASSERT_TRUE(writer.append(conversion(0x123456u)));
+	ASSERT_TRUE(CaptureWriter::record(&writer, conversion(0xFFFFFEu)));
+	ASSERT_TRUE(writer.flush());
+
+	EXPECT_EQ(writer.recordCount(), 2u);
+	ASSERT_EQ(sink.bytes.size(), CaptureHeader::SIZE + 2u * 5u);
+
+	const auto view = CaptureView::parse(sink.bytes.data(), sink.bytes.size());
+	ASSERT_TRUE(view);
+	ASSERT_EQ(view->size(), 2u);
+
+	EXPECT_EQ(view->records(), &sink.bytes[CaptureHeader::SIZE]); // Zero-copy
+	EXPECT_EQ((*view)[0].data(), 0x123456u);
+	EXPECT_EQ((*view)[0].status(), 0x00u);
+	EXPECT_EQ((*view)[0].toRDATA().crcValid(), true);
+	EXPECT_EQ((*view)[1].code(), -2);
+	EXPECT_EQ((*view)[1].crc(), conversion(0xFFFFFEu).crc);
+}
+
+TEST(CaptureWriter_Test, fillsAbsentBytes) {
+	MemorySink	  sink{};
+	CaptureWriter writer{MemorySink::write, &sink};
+
+	ASSERT_TRUE(writer.begin(makeHeader(true, false)));
+	ASSERT_TRUE(writer.append(ADS124S08::RDATA{std::nullopt, 0x000001u, std::nullopt}));
+	ASSERT_TRUE(writer.flush());
+
+	const auto view = CaptureView::parse(sink.bytes.data(), sink.bytes.size());
+	ASSERT_TRUE(view);
+	EXPECT_EQ((*view)[0].status(), 0x00u);
+	EXPECT_EQ((*view)[0].crc(), std::nullopt);
+	EXPECT_EQ((*view)[0].code(), 1);
+}
+
+TEST(CaptureWriter_Test, appendsBatches) {
+	MemorySink	  sink{};
+	CaptureWriter writer{MemorySink::write, &sink};
+
+	uint32_t data[3u]	= {0x000001u, 0x7FFFFFu, 0x800000u};
+	Register status[3u] = {0x01u, 0x02u, 0x03u};
+
+	ASSERT_TRUE(writer.begin(makeHeader(true, false)));
+	EXPECT_EQ(writer.append(ADS124S08::RDATABatch{data, status}, 3u), 3u);
+	ASSERT_TRUE(writer.flush());
+
+	const auto view = CaptureView::parse(sink.bytes.data(), sink.bytes.size());
+	ASSERT_TRUE(view);
+
+	std::vector<int32_t>  codes{};
+	std::vector<Register> statuses{};
+	for (const auto sample : *view) {
+		codes.push_back(sample.code());
+		statuses.push_back(*sample.status());
+	}
+	EXPECT_EQ(codes, (std::vector<int32_t>{1, 0x7FFFFF, -0x800000}));
+	EXPECT_EQ(statuses, (std::vector<Register>{0x01u, 0x02u, 0x03u}));
+}
+
+TEST(CaptureWriter_Test, flushesWhenBufferFills) {
+	MemorySink	  sink{};
+	CaptureWriter writer{MemorySink::write, &sink};
+
+	const std::size_t count = 2u * CaptureWriter::BUFFER_SIZE / 3u;
+	ASSERT_TRUE(writer.begin(makeHeader(false, false)));
+	for (std::size_t i = 0u; i < count; i++) {
+		ASSERT_TRUE(writer.append(ADS124S08::RDATA{std::nullopt, uint32_t(i), std::nullopt}));
+	}
+	EXPECT_GE(sink.writes, 1u);
+	ASSERT_TRUE(writer.flush());
+
+	const auto view = CaptureView::parse(sink.bytes.data(), sink.bytes.size());
+	ASSERT_TRUE(view);
+	ASSERT_EQ(view->size(), count);
+	for (std::size_t i = 0u; i < count; i++) {
+		ASSERT_EQ((*view)[i].data(), i);
+	}
+}
+
+TEST(CaptureWriter_Test, reportsSinkFailure) {
+	MemorySink	  sink{};
+	sink.limit = CaptureHeader::SIZE;
+	CaptureWriter writer{MemorySink::write, &sink};
+
+	EXPECT_FALSE(writer.append(conversion(1u))); // Not begun
+	ASSERT_TRUE(writer.begin(makeHeader(false, false)));
+	ASSERT_TRUE(writer.flush());
+
+	ASSERT_TRUE(writer.append(conversion(1u)));
+	EXPECT_FALSE(writer.flush());
+	EXPECT_TRUE(writer.failed());
+	EXPECT_FALSE(CaptureWriter::record(&writer, conversion(2u)));
+}
+
+TEST(CaptureView_Test, ignoresTruncatedRecord) {
+	MemorySink	  sink{};
+	CaptureWriter writer{MemorySink::write, &sink};
+
+	ASSERT_TRUE(writer.begin(makeHeader(false, true)));
+	writer.append(conversion(1u));
+	writer.append(conversion(2u));
+	ASSERT_TRUE(writer.flush());
+
+	const auto view = CaptureView::parse(sink.bytes.data(), sink.bytes.size() - 1u);
+	ASSERT_TRUE(view);
+	EXPECT_EQ(view->size(), 1u);
+}
+
+TEST(CaptureView_Test, packedRecordsConvertInBulk) {
+	MemorySink	  sink{};
+	CaptureWriter writer{MemorySink::write, &sink};
+
+	ASSERT_TRUE(writer.begin(makeHeader(false, false)));
+	writer.append(conversion(0x400000u));
+	writer.append(conversion(0xC00000u));
+	ASSERT_TRUE(writer.flush());
+
+	const auto view = CaptureView::parse(sink.bytes.data(), sink.bytes.size());
+	ASSERT_TRUE(view);
+
+	float voltages[2u];
+	ADS124S08::RDATA::framesToVoltages(view->records(), voltages, view->size());
+	EXPECT_FLOAT_EQ(voltages[0], 1.25f);
+	EXPECT_FLOAT_EQ(voltages[1], -1.25f);
+}
+
+#if __has_include(<sys/mman.h>)
+TEST(CaptureFile_Test, mapsWrittenFile) {
+	const std::string path = ::testing::TempDir() + "ads124s08_capture.bin";
+
+	std::FILE *const file = std::fopen(path.c_str(), "wb");
+	ASSERT_NE(file, nullptr);
+	{
+		CaptureWriter writer{CaptureWriter::writeFile, file};
+		ASSERT_TRUE(writer.begin(makeHeader(true, true)));
+		for (uint32_t i = 0u; i < 1000u; i++) writer.append(conversion(i));
+		ASSERT_TRUE(writer.flush());
+	}
+	std::fclose(file);
+
+	ADS124S08::CaptureFile capture{};
+	const auto			   view = capture.open(path.c_str());
+	ASSERT_TRUE(view);
+	ASSERT_EQ(view->size(), 1000u);
+	EXPECT_EQ(view->header().startNanoseconds, makeHeader(true, true).startNanoseconds);
+	EXPECT_EQ((*view)[999].data(), 999u);
+	EXPECT_EQ((*view)[999].toRDATA().crcValid(), true);
+
+	capture.close();
+	EXPECT_FALSE(capture.open((path + ".missing").c_str()));
+	std::remove(path.c_str());
+}
+#endif
@@ -0,0 +1,245 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <vector>
+
+using Register			 = ADS124S08::Register;
+using Address			 = ADS124S08::Address;
+using AwaitableADS124S08 = ADS124S08::AwaitableADS124S08;
+
+/**
+ * @brief Synchronous SPI used to construct the driver. All registers read as zero.
+ */
+class ZeroRegisterSPI final : public ADS124S08::SPI {
+public:
+	std::optional<uint8_t> read(Register *const, uint8_t count) noexcept override { return count; }
+
+	std::optional<uint8_t> write(const Register *const, uint8_t count) noexcept override {
+		return count;
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const, Register *const rxBuffer, uint8_t count) noexcept override {
+		std::fill_n(rxBuffer, count, 0u);
+		return std::make_tuple(count, count);
+	}
+};
+
+/**
+ * @brief Asynchronous SPI which queues transfers until the event loop of the test completes
+ * them, or completes them within `transfer()` if `immediate`. Registers read as their address,
+ * conversions as the number of reads so far.
+ */
+class EventLoopSPI final : public ADS124S08::AsyncSPI {
+public:
+	struct Transfer {
+		std::vector<Register> tx;
+		Register			 *rxBuffer;
+		Completion			  completion;
+		void				 *context;
+	};
+
+	std::vector<Transfer> queue{};
+	bool				  busy{false};
+	bool				  immediate{false};
+	uint32_t			  conversions{0u};
+
+	bool transfer(
+		const Register *const txBuffer,
+		Register *const		  rxBuffer,
+		uint8_t				  count,
+		Completion			  completion,
+		void				 *context
+	) noexcept override {
+		if (busy) return false;
+		queue.push_back({{txBuffer, txBuffer + count}, rxBuffer, completion, context});
+		if (immediate) completeNext();
+		return true;
+	}
+
+	/**
+	 * @brief Complete the oldest queued transfer.
+	 */
+	void completeNext(void) {
+		Transfer transfer = queue.front();
+		queue.erase(queue.begin());
+
+		if ((transfer.tx[0] & 0xE0u) == 0x20u) {
+			for (std::size_t i = 2u; i < transfer.tx.size(); i++) {
+				transfer.rxBuffer[i] = static_cast<Register>((transfer.tx[0] & 0x1Fu) + i - 2u);
+			}
+		} else if (transfer.tx[0] == ADS124S08::SPI::DataReadCommand::RDATA) {
+			conversions++;
+			transfer.rxBuffer[3] = static_cast<Register>(conversions);
+		}
+		transfer.completion(transfer.context, true);
+	}
+};
+
+class Coroutine_Test : public ::testing::Test {
+public:
+	ZeroRegisterSPI	   spi{};
+	EventLoopSPI	   asyncSpi{};
+	ADS124S08		   adc{spi};
+	AwaitableADS124S08 awaitable{adc, asyncSpi};
+};
+
+static ADS124S08::Task<uint32_t> readOne(AwaitableADS124S08 &adc) {
+	const auto result = co_await adc.rdata();
+	co_return result ? result->data : 0xFFFFFFFFu;
+}
+
+TEST_F(Coroutine_Test, taskSuspendsUntilTransferCompletes) {
+	auto task = readOne(awaitable);
+	EXPECT_TRUE(asyncSpi.queue.empty()); // Lazily started
+
+	task.resume();
+	ASSERT_EQ(asyncSpi.queue.size(), 1u);
+	EXPECT_FALSE(task.done());
+
+	asyncSpi.completeNext();
+	ASSERT_TRUE(task.done());
+	EXPECT_EQ(task.result(), 1u);
+}
+
+TEST_F(Coroutine_Test, failureToStartDoesNotSuspend) {
+	asyncSpi.busy = true;
+
+	auto task = readOne(awaitable);
+	task.resume();
+	ASSERT_TRUE(task.done());
+	EXPECT_EQ(task.result(), 0xFFFFFFFFu);
+}
+
+static ADS124S08::Task<uint32_t> readMany(AwaitableADS124S08 &adc, uint32_t count) {
+	uint32_t data = 0u;
+	for (uint32_t i = 0u; i < count; i++) {
+		const auto result = co_await adc.rdata();
+		if (!result) co_return 0xFFFFFFFFu;
+		data = result->data;
+	}
+	co_return data;
+}
+
+TEST_F(Coroutine_Test, synchronousCompletionDoesNotNest) {
+	asyncSpi.immediate = true;
+
+	// Resuming from within each transfer would nest a frame per read and overflow the stack
+	auto task = readMany(awaitable, 100000u);
+	task.resume();
+	ASSERT_TRUE(task.done());
+	EXPECT_EQ(task.result(), 100000u & 0xFFu); // The count of reads wraps in the LSB
+	EXPECT_EQ(asyncSpi.conversions, 100000u);
+}
+
+static ADS124S08::Task<std::vector<uint32_t>> calibrateConfigureScan(AwaitableADS124S08 &adc) {
+	std::vector<uint32_t> samples{};
+
+	if (!co_await adc.start()) co_return samples;
+	if (!co_await adc.selfOffsetCalibrate()) co_return samples;
+
+	for (uint8_t channel = 0u; channel < 2u; channel++) {
+		const ADS124S08::INPMUX inpmux{static_cast<Register>((channel << 4u) | 0x0Cu)};
+		if (!co_await adc.setRegister(inpmux)) co_return samples;
+
+		co_await adc.waitDrdy();
+		const auto result = co_await adc.rdata();
+		if (result) samples.push_back(result->data);
+	}
+	co_return samples;
+}
+
+TEST_F(Coroutine_Test, sequenceIsWrittenLinearly) {
+	auto task = calibrateConfigureScan(awaitable);
+	task.resume();
+
+	asyncSpi.completeNext(); // START
+	ASSERT_EQ(asyncSpi.queue.size(), 1u);
+	EXPECT_EQ(asyncSpi.queue[0].tx, (std::vector<Register>{0x19u})); // SFOCAL
+
+	asyncSpi.completeNext();
+	EXPECT_TRUE(asyncSpi.queue.empty()); // Waiting for the end of calibration
+	awaitable.notifyDrdy();
+
+	for (uint8_t channel = 0u; channel < 2u; channel++) {
+		ASSERT_EQ(asyncSpi.queue.size(), 1u);
+		EXPECT_EQ(asyncSpi.queue[0].tx[0], 0x42u); // WREG INPMUX
+		asyncSpi.completeNext();
+		EXPECT_EQ(adc.getCachedRegister(Address::INP_MUX), (channel << 4u) | 0x0Cu);
+
+		EXPECT_TRUE(asyncSpi.queue.empty());
+		awaitable.notifyDrdy();
+		asyncSpi.completeNext(); // RDATA
+	}
+
+	ASSERT_TRUE(task.done());
+	EXPECT_EQ(task.result(), (std::vector<uint32_t>{1u, 2u}));
+}
+
+TEST_F(Coroutine_Test, devicesProgressCooperatively) {
+	ZeroRegisterSPI	   otherSpi{};
+	ADS124S08		   otherAdc{otherSpi};
+	AwaitableADS124S08 other{otherAdc, asyncSpi};
+
+	auto first	= readOne(awaitable);
+	auto second = readOne(other);
+	first.resume();
+	second.resume();
+	EXPECT_EQ(asyncSpi.queue.size(), 2u);
+
+	asyncSpi.completeNext();
+	EXPECT_TRUE(first.done());
+	EXPECT_FALSE(second.done());
+
+	asyncSpi.completeNext();
+	EXPECT_EQ(first.result(), 1u);
+	EXPECT_EQ(second.result(), 2u);
+}
+
+static ADS124S08::Task<void> readRegisters(AwaitableADS124S08 &adc, Register *const buffer) {
+	co_await adc.rreg(Address::INP_MUX, 3u, buffer);
+}
+
+TEST_F(Coroutine_Test, rregFillsBufferAndCache) {
+	Register buffer[3u] = {0u};
+
+	auto task = readRegisters(awaitable, buffer);
+	task.resume();
+	asyncSpi.completeNext();
+
+	ASSERT_TRUE(task.done());
+	EXPECT_EQ(buffer[2], static_cast<Register>(Address::DATA_RATE));
+	EXPECT_EQ(adc.getCachedRegister(Address::PGA), static_cast<Register>(Address::PGA));
+}
+
+static ADS124S08::Task<bool> writeRegisters(AwaitableADS124S08 &adc, const Register *const buffer) {
+	co_return (co_await adc.wreg(Address::INP_MUX, 3u, buffer)).has_value();
+}
+
+TEST_F(Coroutine_Test, wregElidesCachedRegisters) {
+	const Register buffer[3u] = {0x00u, 0x05u, 0x00u}; // The cache holds zeros
+
+	auto trimmed = writeRegisters(awaitable, buffer);
+	trimmed.resume();
+	ASSERT_EQ(asyncSpi.queue.size(), 1u);
+	EXPECT_EQ(asyncSpi.queue[0].tx, (std::vector<Register>{0x43u, 0x00u, 0x05u})); // PGA only
+	asyncSpi.completeNext();
+	ASSERT_TRUE(trimmed.done());
+	EXPECT_TRUE(trimmed.result());
+
+	auto elided = writeRegisters(awaitable, buffer);
+	elided.resume();
+	EXPECT_TRUE(asyncSpi.queue.empty());
+	ASSERT_TRUE(elided.done());
+	EXPECT_TRUE(elided.result());
+
+	const auto statistics = adc.getWriteStatistics();
+	EXPECT_EQ(statistics.issuedWrites, 1u);
+	EXPECT_EQ(statistics.elidedWrites, 1u);
+	EXPECT_EQ(statistics.elidedBytes, 5u);
+}
+
+#endif
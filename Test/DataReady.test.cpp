@@ -0,0 +1,192 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using Register = ADS124S08::Register;
+using Address  = ADS124S08::Address;
+
+/**
+ * @brief SPI whose STATUS reports not ready `busyPolls` times, and whose conversions count up.
+ * All other registers read as zero.
+ */
+class StatusPollSPI final : public ADS124S08::SPI {
+public:
+	uint32_t busyPolls{0u};
+	uint32_t statusReads{0u};
+	uint32_t conversions{0u};
+
+	std::optional<uint8_t> read(Register *const, uint8_t count) noexcept override { return count; }
+
+	std::optional<uint8_t> write(const Register *const, uint8_t count) noexcept override {
+		return count;
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const txBuffer, Register *const rxBuffer, uint8_t count) noexcept
+		override {
+		std::fill_n(rxBuffer, count, 0u);
+
+		if (txBuffer[0] == (0x20u | Address::STATUS)) {
+			statusReads++;
+			rxBuffer[2] = statusReads <= busyPolls ? 0x40u : 0x00u; // RDY
+		} else if (txBuffer[0] == ADS124S08::SPI::DataReadCommand::RDATA) {
+			conversions++;
+			rxBuffer[3] = static_cast<Register>(conversions);
+		}
+		return std::make_tuple(count, count);
+	}
+};
+
+struct SleepRecorder {
+	std::vector<uint32_t> sleeps{};
+
+	static void sleep(void *context, uint32_t microseconds) noexcept {
+		static_cast<SleepRecorder *>(context)->sleeps.push_back(microseconds);
+	}
+
+	uint32_t total(void) const {
+		uint32_t sum = 0u;
+		for (const uint32_t s : sleeps) sum += s;
+		return sum;
+	}
+};
+
+static bool collect(void *context, const ADS124S08::RDATA &data) noexcept {
+	auto *const samples = static_cast<std::vector<uint32_t> *>(context);
+	samples->push_back(data.data);
+	return samples->size() < 3u;
+}
+
+class DataReady_Test : public ::testing::Test {
+public:
+	StatusPollSPI	  spi{};
+	ADS124S08	  adc{spi};
+	SleepRecorder recorder{};
+
+	void SetUp() override {
+		adc.setSystemControl(ADS124S08::SYS{}); // No STATUS or CRC bytes
+	}
+};
+
+TEST_F(DataReady_Test, edgeWaitConsumesPendingEdge) {
+	ADS124S08::EdgeDataReady drdy{SleepRecorder::sleep, &recorder, 10u};
+
+	drdy.onEdge();
+	EXPECT_TRUE(drdy.wait(0u));
+	EXPECT_TRUE(recorder.sleeps.empty());
+
+	EXPECT_FALSE(drdy.wait(50u));
+	EXPECT_EQ(recorder.total(), 50u);
+}
+
+TEST_F(DataReady_Test, edgeWaitRequiresSleepForTimeout) {
+	ADS124S08::EdgeDataReady drdy{};
+	drdy.onEdge();
+
+	// Without a sleep the timeout cannot be measured, so the wait fails rather than polling
+	EXPECT_FALSE(drdy.wait(1000u));
+	EXPECT_EQ(adc.acquire(drdy, 1u, nullptr, nullptr, 1000u), 0u);
+	EXPECT_EQ(spi.conversions, 0u);
+
+	EXPECT_TRUE(drdy.wait(0u)); // The edge is still pending
+}
+
+TEST_F(DataReady_Test, edgeWaitWithoutSleepSpinsUntilEdge) {
+	ADS124S08::EdgeDataReady drdy{};
+
+	std::thread edge{[&drdy] {
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		drdy.onEdge();
+	}};
+	EXPECT_TRUE(drdy.wait(ADS124S08::DataReady::WAIT_FOREVER));
+	edge.join();
+}
+
+TEST_F(DataReady_Test, edgeCallbackCountsOverruns) {
+	ADS124S08::EdgeDataReady drdy{};
+
+	ADS124S08::EdgeDataReady::edge(&drdy);
+	ADS124S08::EdgeDataReady::edge(&drdy);
+	ADS124S08::EdgeDataReady::edge(&drdy);
+	EXPECT_TRUE(drdy.wait(0u));
+	EXPECT_EQ(drdy.overruns(), 2u);
+
+	drdy.onEdge();
+	drdy.clear();
+	EXPECT_FALSE(drdy.wait(0u));
+}
+
+/**
+ * @brief Data-ready source raising an edge on every other wait.
+ */
+class AlternatingDataReady final : public ADS124S08::DataReady {
+public:
+	uint32_t waits{0u};
+
+	bool wait(uint32_t) noexcept override { return (++waits % 2u) == 1u; }
+};
+
+TEST_F(DataReady_Test, acquireReadsOncePerEdge) {
+	AlternatingDataReady drdy{};
+
+	EXPECT_EQ(adc.acquire(drdy, 5u), 1u); // Second wait times out
+	EXPECT_EQ(spi.conversions, 1u);
+	EXPECT_EQ(drdy.waits, 2u);
+}
+
+TEST_F(DataReady_Test, edgesBeforeWaitYieldOneRead) {
+	ADS124S08::EdgeDataReady drdy{};
+	for (int i = 0; i < 5; i++) drdy.onEdge();
+
+	EXPECT_EQ(adc.acquire(drdy, 5u, nullptr, nullptr, 0u), 1u);
+	EXPECT_EQ(spi.conversions, 1u);
+	EXPECT_EQ(drdy.overruns(), 4u);
+}
+
+/**
+ * @brief Data-ready source for which a conversion is always ready.
+ */
+class AlwaysDataReady final : public ADS124S08::DataReady {
+public:
+	bool wait(uint32_t) noexcept override { return true; }
+};
+
+TEST_F(DataReady_Test, acquireStopsWhenHandlerRequests) {
+	AlwaysDataReady drdy{};
+
+	std::vector<uint32_t> samples{};
+	EXPECT_EQ(adc.acquire(drdy, 10u, collect, &samples), 3u);
+	EXPECT_EQ(samples, (std::vector<uint32_t>{1u, 2u, 3u}));
+}
+
+TEST_F(DataReady_Test, statusFallbackPollsRdyThenPacesByPeriod) {
+	spi.busyPolls = 2u;
+	ADS124S08::StatusDataReady drdy{adc, SleepRecorder::sleep, &recorder, 100u};
+
+	// Registers read as zero: 2.5 SPS
+	const auto period =
+		ADS124S08::LatencyModel::compute(ADS124S08::PGA{0x00u}, ADS124S08::DATARATE{0x00u});
+
+	EXPECT_TRUE(drdy.wait(ADS124S08::DataReady::WAIT_FOREVER));
+	EXPECT_EQ(spi.statusReads, 3u);
+	EXPECT_EQ(
+		recorder.sleeps, (std::vector<uint32_t>{100u, 100u, period.periodMicroseconds()})
+	);
+}
+
+TEST_F(DataReady_Test, statusFallbackTimesOut) {
+	spi.busyPolls = 100u;
+	ADS124S08::StatusDataReady drdy{adc, SleepRecorder::sleep, &recorder, 100u};
+
+	EXPECT_FALSE(drdy.wait(250u));
+	EXPECT_EQ(recorder.total(), 200u);
+
+	// Ready, but the conversion period exceeds the timeout
+	spi.busyPolls = 0u;
+	EXPECT_FALSE(drdy.wait(10u));
+	EXPECT_EQ(adc.acquire(drdy, 1u, nullptr, nullptr, 10u), 0u);
+}
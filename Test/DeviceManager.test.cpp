@@ -0,0 +1,217 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <vector>
+
+using Register = ADS124S08::Register;
+using Address  = ADS124S08::Address;
+
+/**
+ * @brief Bus transport that records which chip select was asserted for each transfer.
+ * Conversions read as the index of the selected device.
+ */
+class RecordingBus final : public ADS124S08::SPI {
+public:
+	int				 selected{-1};
+	std::vector<int> transfers{};
+
+	std::optional<uint8_t> read(Register *const, uint8_t count) noexcept override { return count; }
+
+	std::optional<uint8_t> write(const Register *const, uint8_t count) noexcept override {
+		transfers.push_back(selected);
+		return count;
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const txBuffer, Register *const rxBuffer, uint8_t count) noexcept
+		override {
+		transfers.push_back(selected);
+		std::fill_n(rxBuffer, count, 0u);
+		if (txBuffer[0] == ADS124S08::SPI::DataReadCommand::RDATA) {
+			rxBuffer[3] = static_cast<Register>(selected);
+		}
+		return std::make_tuple(count, count);
+	}
+};
+
+struct ChipSelectPin {
+	RecordingBus &bus;
+	int			  index;
+
+	static void drive(void *context, bool selected) noexcept {
+		auto *const pin = static_cast<ChipSelectPin *>(context);
+		EXPECT_EQ(pin->bus.selected, selected ? -1 : pin->index); // Never two at once
+		pin->bus.selected = selected ? pin->index : -1;
+	}
+};
+
+using Manager = ADS124S08::DeviceManager<40u>;
+
+struct Sample {
+	std::size_t				device;
+	uint32_t				data;
+	std::optional<uint64_t> timestamp;
+};
+
+static void collect(void *context, const Manager::Sample &sample) noexcept {
+	static_cast<std::vector<Sample> *>(context)->push_back(
+		{sample.device, sample.data.data, sample.timestamp}
+	);
+}
+
+/**
+ * @brief Monotonic clock advancing by `step` nanoseconds each time it is read.
+ */
+struct SteppedClock {
+	uint64_t now{0u};
+	uint64_t step{0u};
+
+	static uint64_t read(void *context) noexcept {
+		auto *const	   clock = static_cast<SteppedClock *>(context);
+		const uint64_t time	 = clock->now;
+		clock->now += clock->step;
+		return time;
+	}
+};
+
+class DeviceManager_Test : public ::testing::Test {
+public:
+	RecordingBus			   transport{};
+	ADS124S08::SharedBus	   bus{transport};
+	std::vector<ChipSelectPin> pins{};
+
+	Manager manager{};
+
+	void SetUp() override {
+		pins.reserve(40u);
+		for (int i = 0; i < 40; i++) {
+			pins.push_back({transport, i});
+			ASSERT_EQ(manager.addDevice(bus, ChipSelectPin::drive, &pins.back()), std::size_t(i));
+			manager.device(i).setSystemControl(ADS124S08::SYS{}); // No STATUS or CRC bytes
+		}
+		transport.transfers.clear();
+	}
+};
+
+TEST_F(DeviceManager_Test, devicesAreConstructedThroughTheirChipSelect) {
+	RecordingBus			 other{};
+	ADS124S08::SharedBus	 otherBus{other};
+	ChipSelectPin			 pin{other, 7};
+	ADS124S08::DeviceManager<1u> single{};
+
+	EXPECT_EQ(single.addDevice(otherBus, ChipSelectPin::drive, &pin), 0u);
+	EXPECT_EQ(other.transfers, (std::vector<int>{7})); // Register file read
+	EXPECT_FALSE(single.addDevice(otherBus, ChipSelectPin::drive, &pin).has_value());
+	EXPECT_EQ(single.size(), 1u);
+}
+
+TEST_F(DeviceManager_Test, onlyReadyDevicesAreRead) {
+	manager.markReady(33u);
+	manager.markReady(2u);
+
+	std::vector<Sample> samples{};
+	EXPECT_EQ(manager.service(collect, &samples), 2u);
+
+	ASSERT_EQ(samples.size(), 2u);
+	EXPECT_EQ(samples[0].device, 2u);
+	EXPECT_EQ(samples[0].data, 2u);
+	EXPECT_EQ(samples[1].device, 33u);
+	EXPECT_EQ(samples[1].data, 33u);
+	EXPECT_EQ(transport.transfers, (std::vector<int>{2, 33}));
+
+	EXPECT_FALSE(manager.isReady(2u));
+	EXPECT_EQ(manager.service(collect, &samples), 0u);
+}
+
+TEST_F(DeviceManager_Test, serviceIsRoundRobin) {
+	std::vector<Sample> samples{};
+
+	manager.markReady(1u);
+	manager.markReady(5u);
+	EXPECT_EQ(manager.service(collect, &samples, ADS124S08::DataReadMode::COMMAND, 1u), 1u);
+	EXPECT_EQ(samples.back().device, 1u);
+
+	// Device 1 is ready again, but device 5 is next in turn
+	manager.markReady(1u);
+	EXPECT_EQ(manager.service(collect, &samples, ADS124S08::DataReadMode::COMMAND, 1u), 1u);
+	EXPECT_EQ(samples.back().device, 5u);
+
+	EXPECT_EQ(manager.service(collect, &samples), 1u);
+	EXPECT_EQ(samples.back().device, 1u);
+}
+
+TEST_F(DeviceManager_Test, busyBusFailsTransaction) {
+	ASSERT_TRUE(bus.acquire()); // Transaction from another context
+
+	manager.markReady(3u);
+	EXPECT_EQ(manager.service(nullptr), 0u);
+	EXPECT_TRUE(transport.transfers.empty());
+	EXPECT_EQ(transport.selected, -1);
+
+	bus.release();
+	EXPECT_FALSE(bus.busy());
+}
+
+TEST_F(DeviceManager_Test, outOfRangeDevicesAreIgnored) {
+	manager.markReady(40u);
+	EXPECT_FALSE(manager.isReady(40u));
+	EXPECT_EQ(manager.service(nullptr), 0u);
+}
+
+TEST_F(DeviceManager_Test, groupStartTimestampsEachDevice) {
+	SteppedClock clock{1000000u, 500u};
+	manager.setTimeSource(SteppedClock::read, &clock);
+
+	const std::size_t group[2u] = {0u, 1u};
+	transport.transfers.clear();
+	EXPECT_EQ(manager.start(group, 2u), 2u);
+	EXPECT_EQ(transport.transfers, (std::vector<int>{0, 1})); // Back to back
+
+	manager.markReady(0u);
+	manager.markReady(1u);
+	manager.markReady(2u); // Not started with the group
+
+	std::vector<Sample> samples{};
+	EXPECT_EQ(manager.service(collect, &samples), 3u);
+	ASSERT_EQ(samples.size(), 3u);
+	EXPECT_EQ(samples[0].timestamp, 1000000u);
+	EXPECT_EQ(samples[1].timestamp, 1000500u);
+	EXPECT_FALSE(samples[2].timestamp.has_value());
+
+	EXPECT_EQ(manager.stop(), 40u);
+	manager.markReady(0u);
+	EXPECT_EQ(manager.service(collect, &samples), 1u);
+	EXPECT_FALSE(samples.back().timestamp.has_value());
+}
+
+struct EdgeDuringHandler {
+	Manager			   &manager;
+	SteppedClock	   &clock;
+	std::vector<Sample> samples{};
+
+	static void handle(void *context, const Manager::Sample &sample) noexcept {
+		auto *const self = static_cast<EdgeDuringHandler *>(context);
+		collect(&self->samples, sample);
+		if (self->samples.size() == 1u) {
+			self->clock.now += 250000u; // The next conversion of the device
+			self->manager.markReady(sample.device);
+		}
+	}
+};
+
+TEST_F(DeviceManager_Test, timestampIsTheTimeOfTheEdge) {
+	SteppedClock clock{};
+	manager.setTimeSource(SteppedClock::read, &clock);
+	EXPECT_EQ(manager.start(), 40u);
+
+	clock.now = 2000000u;
+	manager.markReady(3u);
+	clock.now = 10000000000u; // Serviced long after the edge
+
+	EdgeDuringHandler handler{manager, clock};
+	EXPECT_EQ(manager.service(EdgeDuringHandler::handle, &handler), 2u);
+	ASSERT_EQ(handler.samples.size(), 2u);
+	EXPECT_EQ(handler.samples[0].timestamp, 2000000u);
+	EXPECT_EQ(handler.samples[1].timestamp, 10000250000u);
+}
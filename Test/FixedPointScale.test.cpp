@@ -0,0 +1,80 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <cmath>
+
+using FixedPointScale = ADS124S08::FixedPointScale;
+using GAIN_SELECT	  = ADS124S08::PGA::GAIN_SELECT;
+using RefSelect		  = ADS124S08::REF::InternalReferenceSelect;
+
+// Scales are usable at compile time
+static constexpr FixedPointScale unityScale{GAIN_SELECT::GAIN_1};
+static_assert(unityScale.toMicrovolts(0x000000u) == 0);
+static_assert(unityScale.toMicrovolts(0x800000u) == -2500000);
+static_assert(unityScale.toNanovolts(0x400000u) == 1250000000);
+
+static double referenceNanovolts(uint32_t code, double gain, double vRefMicrovolts) {
+	int32_t signedCode = static_cast<int32_t>(code);
+	if (code & 0x800000u) signedCode -= 0x1000000;
+	return signedCode * vRefMicrovolts * 1000.0 / (gain * 0x800000);
+}
+
+TEST(FixedPointScale_Test, conversionsMatchFloatingPointWithinHalfUnit) {
+	const uint32_t codes[] = {
+		0x000000u, 0x000001u, 0x7FFFFFu, 0x800000u, 0xFFFFFFu, 0x123456u, 0xABCDEFu, 0x654321u,
+	};
+
+	for (uint8_t gainBits = 0u; gainBits <= 7u; gainBits++) {
+		const auto	 gain  = static_cast<GAIN_SELECT>(gainBits);
+		const double ratio = static_cast<double>(1u << gainBits);
+
+		for (const uint32_t vRef : {2500000u, 3300000u, 5000000u}) {
+			const FixedPointScale scale{gain, vRef};
+
+			for (const uint32_t code : codes) {
+				const double expected = referenceNanovolts(code, ratio, vRef);
+
+				EXPECT_LE(std::fabs(scale.toNanovolts(code) - expected), 0.5)
+					<< "Code " << code << ", gain " << ratio << ", vRef " << vRef;
+				EXPECT_LE(std::fabs(scale.toMicrovolts(code) - expected / 1000.0), 0.5)
+					<< "Code " << code << ", gain " << ratio << ", vRef " << vRef;
+			}
+		}
+	}
+}
+
+TEST(FixedPointScale_Test, referenceSelectionChoosesInternalReference) {
+	const FixedPointScale internal{GAIN_SELECT::GAIN_1, RefSelect::INTERNAL, 3300000u};
+	const FixedPointScale external{GAIN_SELECT::GAIN_1, RefSelect::REFP0_REFN0, 3300000u};
+
+	EXPECT_EQ(-2500000, internal.toMicrovolts(0x800000u));
+	EXPECT_EQ(-3300000, external.toMicrovolts(0x800000u));
+}
+
+TEST(FixedPointScale_Test, registerConstructorTreatsBypassedPgaAsUnityGain) {
+	ADS124S08::PGA pga{};
+	ADS124S08::REF ref{};
+	ref.setReferenceInputSelection(RefSelect::INTERNAL);
+
+	pga.setGain(GAIN_SELECT::GAIN_4);
+	EXPECT_EQ(-625000, FixedPointScale(pga, ref).toMicrovolts(0x800000u));
+
+	pga.setEnable(ADS124S08::PGA::ENABLE::BYPASSED, false);
+	EXPECT_EQ(-2500000, FixedPointScale(pga, ref).toMicrovolts(0x800000u));
+}
+
+TEST(FixedPointScale_Test, arrayConversionsMatchSingleConversions) {
+	const FixedPointScale scale{GAIN_SELECT::GAIN_16, 2048000u};
+	const uint32_t		  codes[] = {0x000010u, 0x7FFFF0u, 0x800010u, 0xFFFFF0u};
+
+	int32_t microvolts[4u];
+	int64_t nanovolts[4u];
+	scale.toMicrovolts(codes, microvolts, 4u);
+	scale.toNanovolts(codes, nanovolts, 4u);
+
+	for (size_t i = 0u; i < 4u; i++) {
+		EXPECT_EQ(scale.toMicrovolts(codes[i]), microvolts[i]);
+		EXPECT_EQ(scale.toNanovolts(codes[i]), nanovolts[i]);
+	}
+}
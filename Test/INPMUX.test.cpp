@@ -2,7 +2,7 @@
 
 #define ADS124S08_GTEST_TESTING
 
-#include "../Src/INPMUX.cpp"
+#include "ADS124S08.hpp"
 
 using INPMUX	  = ADS124S08::INPMUX;
 using Register	  = ADS124S08::Register;
@@ -31,8 +31,8 @@ TEST(INPMUX_Test, constructor_InitializesFieldsCorrectly_FromRegister) {
 
 	for (const auto &testCase : testCases) {
 		const INPMUX &inpmux = INPMUX(testCase.first);
-		EXPECT_EQ(testCase.second[0], inpmux.MUXP);
-		EXPECT_EQ(testCase.second[1], inpmux.MUXN);
+		EXPECT_EQ(testCase.second[0], INPMUX::MUXP::unpack(inpmux.reg));
+		EXPECT_EQ(testCase.second[1], INPMUX::MUXN::unpack(inpmux.reg));
 	}
 }
 
@@ -52,8 +52,8 @@ TEST(INPMUX_Test, constructor_InitializesFieldsCorrectly_FromInputSelect) {
 	for (const auto &testCase : testCases) {
 		const INPMUX &inpmux = INPMUX(testCase.first.first, testCase.first.second);
 
-		EXPECT_EQ(testCase.second.first, inpmux.MUXP);
-		EXPECT_EQ(testCase.second.second, inpmux.MUXN);
+		EXPECT_EQ(testCase.second.first, INPMUX::MUXP::unpack(inpmux.reg));
+		EXPECT_EQ(testCase.second.second, INPMUX::MUXN::unpack(inpmux.reg));
 	}
 }
 
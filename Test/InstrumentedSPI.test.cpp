@@ -0,0 +1,180 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <vector>
+
+using Register		  = ADS124S08::Register;
+using Address		  = ADS124S08::Address;
+using InstrumentedSPI = ADS124S08::InstrumentedSPI;
+using Operation		  = InstrumentedSPI::Operation;
+
+/**
+ * @brief SPI advancing a fake clock by `nanosecondsPerByte` per byte. Registers read as zero.
+ */
+class TimedSPI final : public ADS124S08::SPI {
+public:
+	uint64_t clock{0u};
+	uint64_t nanosecondsPerByte{1000u};
+	bool	 fail{false};
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override {
+		if (fail) return std::nullopt;
+		std::fill_n(buffer, count, 0u);
+		clock += count * nanosecondsPerByte;
+		return count;
+	}
+
+	std::optional<uint8_t> write(const Register *const, uint8_t count) noexcept override {
+		if (fail) return std::nullopt;
+		clock += count * nanosecondsPerByte;
+		return count;
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const, Register *const rxBuffer, uint8_t count) noexcept override {
+		if (fail) return std::nullopt;
+		std::fill_n(rxBuffer, count, 0u);
+		clock += count * nanosecondsPerByte;
+		return std::make_tuple(count, count);
+	}
+
+	static uint64_t now(void *context) noexcept { return static_cast<TimedSPI *>(context)->clock; }
+};
+
+static void collectTrace(void *context, const InstrumentedSPI::Trace &trace) noexcept {
+	static_cast<std::vector<InstrumentedSPI::Trace> *>(context)->push_back(trace);
+}
+
+class InstrumentedSPI_Test : public ::testing::Test {
+public:
+	TimedSPI		spi{};
+	InstrumentedSPI instrumented{spi, TimedSPI::now, &spi};
+
+	void SetUp(void) override {
+		if (!InstrumentedSPI::ENABLED) GTEST_SKIP() << "Instrumentation compiled out";
+	}
+};
+
+TEST(InstrumentedSPI_Classify, opcodes) {
+	EXPECT_EQ(InstrumentedSPI::classify(0x20u | Address::SYS), Operation::RREG);
+	EXPECT_EQ(InstrumentedSPI::classify(0x40u | Address::INP_MUX), Operation::WREG);
+	EXPECT_EQ(InstrumentedSPI::classify(0x12u), Operation::RDATA);
+	EXPECT_EQ(InstrumentedSPI::classify(0x13u), Operation::RDATA);
+	EXPECT_EQ(InstrumentedSPI::classify(0x00u), Operation::RDATA); // Direct read
+	EXPECT_EQ(InstrumentedSPI::classify(0x08u), Operation::COMMAND);
+	EXPECT_EQ(InstrumentedSPI::classify(0x19u), Operation::COMMAND);
+}
+
+TEST(InstrumentedSPI_Classify, histogramBuckets) {
+	EXPECT_EQ(InstrumentedSPI::bucket(0u), 0u);
+	EXPECT_EQ(InstrumentedSPI::bucket(255u), 0u);
+	EXPECT_EQ(InstrumentedSPI::bucket(256u), 1u);
+	EXPECT_EQ(InstrumentedSPI::bucket(511u), 1u);
+	EXPECT_EQ(InstrumentedSPI::bucket(512u), 2u);
+	EXPECT_EQ(InstrumentedSPI::bucket(UINT32_MAX), InstrumentedSPI::HISTOGRAM_BUCKETS - 1u);
+}
+
+TEST(InstrumentedSPI_Classify, busBypassesWrapperWhenDisabled) {
+	TimedSPI		spi{};
+	InstrumentedSPI instrumented{spi};
+
+	ADS124S08::SPI *const expected = InstrumentedSPI::ENABLED
+										 ? static_cast<ADS124S08::SPI *>(&instrumented)
+										 : static_cast<ADS124S08::SPI *>(&spi);
+	EXPECT_EQ(&instrumented.bus(), expected);
+}
+
+TEST_F(InstrumentedSPI_Test, countsDriverOperations) {
+	ADS124S08 adc{instrumented.bus()}; // RREG of all registers
+
+	adc.start();
+	adc.setRegister(ADS124S08::INPMUX{0x12u});
+	adc.rdata(false, false);
+	adc.rdataDirect(false, false);
+
+	const auto snapshot = instrumented.snapshot();
+	EXPECT_EQ(snapshot[Operation::RREG].count, 1u);
+	EXPECT_EQ(snapshot[Operation::RREG].bytes, 2u + ADS124S08::REGISTER_COUNT);
+	EXPECT_EQ(snapshot[Operation::WREG].count, 1u);
+	EXPECT_EQ(snapshot[Operation::WREG].bytes, 3u);
+	EXPECT_EQ(snapshot[Operation::COMMAND].count, 1u);
+	EXPECT_EQ(snapshot[Operation::RDATA].count, 2u);
+	EXPECT_EQ(snapshot[Operation::RDATA].bytes, 4u + 3u);
+}
+
+TEST_F(InstrumentedSPI_Test, recordsLatency) {
+	const Register command = ADS124S08::SPI::ControlCommand::START;
+	instrumented.write(&command, 1u);
+
+	Register frame[4u] = {ADS124S08::SPI::DataReadCommand::RDATA};
+	instrumented.readWrite(frame, frame, 4u);
+
+	spi.nanosecondsPerByte = 100u;
+	instrumented.readWrite(frame, frame, 4u);
+
+	const auto rdata = instrumented.snapshot()[Operation::RDATA];
+	EXPECT_EQ(rdata.count, 2u);
+	EXPECT_EQ(rdata.totalNanoseconds, 4400u);
+	EXPECT_EQ(rdata.minNanoseconds, 400u);
+	EXPECT_EQ(rdata.maxNanoseconds, 4000u);
+	EXPECT_EQ(rdata.histogram[InstrumentedSPI::bucket(400u)], 1u);
+	EXPECT_EQ(rdata.histogram[InstrumentedSPI::bucket(4000u)], 1u);
+
+	const auto commands = instrumented.snapshot()[Operation::COMMAND];
+	EXPECT_EQ(commands.histogram[InstrumentedSPI::bucket(1000u)], 1u);
+}
+
+TEST_F(InstrumentedSPI_Test, countsFailures) {
+	spi.fail = true;
+
+	Register frame[4u] = {ADS124S08::SPI::DataReadCommand::RDATA};
+	EXPECT_FALSE(instrumented.readWrite(frame, frame, 4u));
+
+	const auto rdata = instrumented.snapshot()[Operation::RDATA];
+	EXPECT_EQ(rdata.count, 1u);
+	EXPECT_EQ(rdata.failures, 1u);
+	EXPECT_EQ(rdata.bytes, 0u);
+}
+
+TEST_F(InstrumentedSPI_Test, tracesTransfers) {
+	std::vector<InstrumentedSPI::Trace> traces{};
+	instrumented.setTracer(collectTrace, &traces);
+
+	spi.clock = 5000u;
+	const Register wreg[3u] = {0x40u | Address::PGA, 0x00u, 0x08u};
+	instrumented.write(wreg, 3u);
+
+	ASSERT_EQ(traces.size(), 1u);
+	EXPECT_EQ(traces[0].operation, Operation::WREG);
+	EXPECT_EQ(traces[0].opcode, wreg[0]);
+	EXPECT_EQ(traces[0].count, 3u);
+	EXPECT_TRUE(traces[0].success);
+	EXPECT_EQ(traces[0].start, 5000u);
+	EXPECT_EQ(traces[0].duration, 3000u);
+}
+
+TEST_F(InstrumentedSPI_Test, resetClearsStatistics) {
+	const Register command = ADS124S08::SPI::ControlCommand::STOP;
+	instrumented.write(&command, 1u);
+	instrumented.reset();
+
+	const auto stop = instrumented.snapshot()[Operation::COMMAND];
+	EXPECT_EQ(stop.count, 0u);
+	EXPECT_EQ(stop.maxNanoseconds, 0u);
+	EXPECT_EQ(stop.minNanoseconds, UINT32_MAX);
+}
+
+TEST(InstrumentedSPI_NoClock, countsWithoutLatency) {
+	TimedSPI		spi{};
+	InstrumentedSPI instrumented{spi};
+	if (!InstrumentedSPI::ENABLED) GTEST_SKIP() << "Instrumentation compiled out";
+
+	const Register command = ADS124S08::SPI::ControlCommand::WAKEUP;
+	instrumented.write(&command, 1u);
+
+	const auto wakeup = instrumented.snapshot()[Operation::COMMAND];
+	EXPECT_EQ(wakeup.count, 1u);
+	EXPECT_EQ(wakeup.totalNanoseconds, 0u);
+	EXPECT_EQ(wakeup.histogram[0], 0u);
+}
@@ -0,0 +1,131 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+using LatencyModel	   = ADS124S08::LatencyModel;
+using CONVERSION_DELAY = LatencyModel::CONVERSION_DELAY;
+using DataRate		   = LatencyModel::DataRate;
+using FilterSelect	   = LatencyModel::FilterSelect;
+using ChopperEnable	   = LatencyModel::ChopperEnable;
+using DATARATE		   = ADS124S08::DATARATE;
+using PGA			   = ADS124S08::PGA;
+
+TEST(LatencyModel_Test, sinc3SettlesInThreePeriods) {
+	const auto latency =
+		LatencyModel::compute(CONVERSION_DELAY::DELAY_14, DataRate::RATE_20, FilterSelect::SINC3);
+
+	EXPECT_EQ(latency.firstSample, 14u + 3u * 12800u);
+	EXPECT_EQ(latency.period, 12800u);
+	EXPECT_EQ(latency.periodMicroseconds(), 50000u);
+	EXPECT_EQ(latency.firstSampleMicroseconds(), 150055u);
+}
+
+TEST(LatencyModel_Test, lowLatencySettlesInOnePeriod) {
+	const auto latency = LatencyModel::compute(
+		CONVERSION_DELAY::DELAY_1,
+		DataRate::RATE_4000,
+		FilterSelect::LOW_LATENCY
+	);
+
+	EXPECT_EQ(latency.firstSample, 1u + 64u);
+	EXPECT_EQ(latency.period, 64u);
+	EXPECT_EQ(latency.periodMicroseconds(), 250u);
+}
+
+TEST(LatencyModel_Test, globalChopAveragesTwoSettledConversions) {
+	const auto latency = LatencyModel::compute(
+		CONVERSION_DELAY::DELAY_64,
+		DataRate::RATE_100,
+		FilterSelect::LOW_LATENCY,
+		ChopperEnable::ENABLED
+	);
+
+	EXPECT_EQ(latency.firstSample, 2u * (64u + 2560u));
+	EXPECT_EQ(latency.period, 64u + 2560u);
+}
+
+TEST(LatencyModel_Test, computeReadsRegisterFields) {
+	const PGA	   pga{0x00u};		// DELAY_14
+	const DATARATE datarate{0x04u}; // 20 SPS, SINC3
+
+	const auto latency = LatencyModel::compute(pga, datarate);
+	EXPECT_EQ(latency.firstSample, 14u + 3u * 12800u);
+}
+
+TEST(LatencyModel_Test, externalClockScalesTime) {
+	const auto latency =
+		LatencyModel::compute(CONVERSION_DELAY::DELAY_14, DataRate::RATE_20, FilterSelect::SINC3);
+
+	EXPECT_EQ(latency.periodMicroseconds(LatencyModel::INTERNAL_CLOCK_HZ / 2u), 100000u);
+	EXPECT_FLOAT_EQ(
+		LatencyModel::bandwidth(DataRate::RATE_20, FilterSelect::SINC3, 2048000u),
+		10.0f * 0.262f
+	);
+}
+
+TEST(LatencyModel_Test, scheduleWithoutConstraintsPicksFastest) {
+	const auto configuration = LatencyModel::schedule({});
+	ASSERT_TRUE(configuration.has_value());
+
+	EXPECT_EQ(configuration->delay, CONVERSION_DELAY::DELAY_1);
+	EXPECT_EQ(configuration->rate, DataRate::RATE_4000);
+	EXPECT_EQ(configuration->filter, FilterSelect::LOW_LATENCY);
+	EXPECT_EQ(configuration->latency.firstSample, 65u);
+}
+
+TEST(LatencyModel_Test, scheduleRespectsSettlingTime) {
+	LatencyModel::Requirements requirements{};
+	requirements.settlingMicroseconds = 200u; // 51.2 t_MOD
+
+	const auto configuration = LatencyModel::schedule(requirements);
+	ASSERT_TRUE(configuration.has_value());
+	EXPECT_EQ(configuration->delay, CONVERSION_DELAY::DELAY_64);
+
+	requirements.settlingMicroseconds = 20000u; // Beyond DELAY_4096
+	EXPECT_FALSE(LatencyModel::schedule(requirements).has_value());
+}
+
+TEST(LatencyModel_Test, scheduleRespectsNoiseBandwidth) {
+	LatencyModel::Requirements requirements{};
+	requirements.maxBandwidth = 30.0f;
+
+	const auto configuration = LatencyModel::schedule(requirements);
+	ASSERT_TRUE(configuration.has_value());
+
+	// Low-latency 60 SPS (26.4 Hz) settles faster than SINC3 100 SPS (26.2 Hz)
+	EXPECT_EQ(configuration->rate, DataRate::RATE_60);
+	EXPECT_EQ(configuration->filter, FilterSelect::LOW_LATENCY);
+	EXPECT_LE(
+		LatencyModel::bandwidth(configuration->rate, configuration->filter),
+		requirements.maxBandwidth
+	);
+
+	requirements.minBandwidth = 31.0f;
+	EXPECT_FALSE(LatencyModel::schedule(requirements).has_value());
+}
+
+TEST(LatencyModel_Test, scheduleAppliesGlobalChop) {
+	LatencyModel::Requirements requirements{};
+	requirements.globalChop = true;
+
+	const auto configuration = LatencyModel::schedule(requirements);
+	ASSERT_TRUE(configuration.has_value());
+	EXPECT_EQ(configuration->chop, ChopperEnable::ENABLED);
+
+	PGA		 pga{0x08u}; // PGA enabled, DELAY_14
+	DATARATE datarate{0x14u};
+	configuration->apply(pga, datarate);
+
+	EXPECT_EQ(pga.getDelay(), CONVERSION_DELAY::DELAY_1);
+	EXPECT_EQ(pga.getEnable(), PGA::ENABLE::ENABLED);
+	EXPECT_EQ(datarate.getGlobalChop(), ChopperEnable::ENABLED);
+	EXPECT_EQ(datarate.getDataRate(), DataRate::RATE_4000);
+	EXPECT_EQ(LatencyModel::compute(pga, datarate).firstSample, configuration->latency.firstSample);
+}
+
+TEST(LatencyModel_Test, nanosecondsRoundsToNearest) {
+	EXPECT_EQ(LatencyModel::nanoseconds(64u), 250000u); // 4000 SPS
+	EXPECT_EQ(LatencyModel::nanoseconds(1u), 3906u);	  // 3906.25 ns
+	EXPECT_EQ(LatencyModel::nanoseconds(1u, 8192000u), 1953u);
+	EXPECT_EQ(LatencyModel::nanoseconds(1u, 0u), 0u);
+}
@@ -2,8 +2,6 @@
 
 #define ADS124S08_GTEST_TESTING
 
-#include "../Src/PGA.cpp"
-
 #include "ADS124S08.hpp"
 
 using PGA	   = ADS124S08::PGA;
@@ -32,9 +30,9 @@ TEST(PGA_Test, constructor_InitializesFieldsCorrectly_FromRegister) {
 
 	for (const auto &[reg, expected] : testCases) {
 		PGA pga(reg);
-		EXPECT_EQ(expected[0], pga.DELAY);
-		EXPECT_EQ(expected[1], pga.PGA_EN);
-		EXPECT_EQ(expected[2], pga.GAIN);
+		EXPECT_EQ(expected[0], PGA::DELAY::unpack(pga.reg));
+		EXPECT_EQ(expected[1], PGA::PGA_EN::unpack(pga.reg));
+		EXPECT_EQ(expected[2], PGA::GAIN::unpack(pga.reg));
 	}
 }
 
@@ -118,3 +116,11 @@ TEST(PGA_Test, getResetValue_returnsCorrectValue) {
 	PGA pga;
 	EXPECT_EQ(0x00u, pga.getResetValue());
 }
+
+TEST(PGA_Test, gettersReturnFieldValues) {
+	const PGA pga(0b10101011u);
+
+	EXPECT_EQ(PGA::CONVERSION_DELAY::DELAY_2048, pga.getDelay());
+	EXPECT_EQ(PGA::ENABLE::ENABLED, pga.getEnable());
+	EXPECT_EQ(PGA::GAIN_SELECT::GAIN_8, pga.getGain());
+}
@@ -0,0 +1,89 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <vector>
+
+using Register = ADS124S08::Register;
+using RDATA	   = ADS124S08::RDATA;
+
+// Includes the extremes, both sides of the sign bit, and enough codes to exercise vector tails
+static std::vector<uint32_t> makeTestCodes(void) {
+	std::vector<uint32_t> codes = {
+		0x000000u, 0x000001u, 0x7FFFFFu, 0x800000u, 0x800001u, 0xFFFFFFu, 0x400000u, 0xC00000u,
+	};
+	for (uint32_t i = 0u; i < 29u; i++) {
+		codes.push_back((i * 0x0A3F1Bu) & 0xFFFFFFu);
+	}
+	return codes;
+}
+
+static std::vector<Register> packFrames(const std::vector<uint32_t> &codes) {
+	std::vector<Register> frames;
+	for (const auto code : codes) {
+		frames.push_back(static_cast<Register>(code >> 16u));
+		frames.push_back(static_cast<Register>(code >> 8u));
+		frames.push_back(static_cast<Register>(code));
+	}
+	return frames;
+}
+
+TEST(RDATA_Test, toVoltagesMatchesScalarConversion) {
+	const auto codes = makeTestCodes();
+
+	for (const float pgaGain : {1.0f, 2.0f, 128.0f}) {
+		std::vector<float> voltages(codes.size());
+		RDATA::toVoltages(codes.data(), voltages.data(), codes.size(), pgaGain, 2.5f);
+
+		for (size_t i = 0u; i < codes.size(); i++) {
+			RDATA rdata;
+			rdata.data = codes[i];
+			EXPECT_NEAR(rdata.toVoltage(pgaGain, 2.5f), voltages[i], 1e-6f) << "Index " << i;
+		}
+	}
+}
+
+TEST(RDATA_Test, toVoltagesDoubleMatchesScalarConversion) {
+	const auto codes = makeTestCodes();
+
+	std::vector<double> voltages(codes.size());
+	RDATA::toVoltages(codes.data(), voltages.data(), codes.size(), 4.0, 2.5);
+
+	for (size_t i = 0u; i < codes.size(); i++) {
+		int32_t signedCode = static_cast<int32_t>(codes[i]);
+		if (codes[i] & 0x800000u) signedCode -= 0x1000000;
+		EXPECT_DOUBLE_EQ(signedCode * (2.5 / 4.0) / 0x800000, voltages[i]) << "Index " << i;
+	}
+}
+
+TEST(RDATA_Test, toVoltagesCalculatesExtremes) {
+	const uint32_t codes[] = {0x7FFFFFu, 0x800000u, 0x000000u, 0xFFFFFFu};
+	float		   voltages[4u];
+
+	RDATA::toVoltages(codes, voltages, 4u);
+
+	EXPECT_NEAR(2.5f, voltages[0], 1e-6f);
+	EXPECT_FLOAT_EQ(-2.5f, voltages[1]);
+	EXPECT_FLOAT_EQ(0.0f, voltages[2]);
+	EXPECT_NEAR(0.0f, voltages[3], 1e-6f);
+	EXPECT_LT(voltages[3], 0.0f);
+}
+
+TEST(RDATA_Test, framesToVoltagesMatchesCodeConversion) {
+	const auto codes  = makeTestCodes();
+	const auto frames = packFrames(codes);
+
+	// Every length exercises a different split between vector body and scalar tail
+	for (size_t count = 0u; count <= codes.size(); count++) {
+		std::vector<float>	expectedFloat(count), actualFloat(count);
+		std::vector<double> expectedDouble(count), actualDouble(count);
+
+		RDATA::toVoltages(codes.data(), expectedFloat.data(), count, 8.0f, 3.3f);
+		RDATA::framesToVoltages(frames.data(), actualFloat.data(), count, 8.0f, 3.3f);
+		RDATA::toVoltages(codes.data(), expectedDouble.data(), count, 8.0, 3.3);
+		RDATA::framesToVoltages(frames.data(), actualDouble.data(), count, 8.0, 3.3);
+
+		EXPECT_EQ(expectedFloat, actualFloat) << "Count " << count;
+		EXPECT_EQ(expectedDouble, actualDouble) << "Count " << count;
+	}
+}
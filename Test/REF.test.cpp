@@ -2,7 +2,7 @@
 
 #define ADS124S08_GTEST_TESTING
 
-#include "../Src/REF.cpp"
+#include "ADS124S08.hpp"
 
 using REF	   = ADS124S08::REF;
 using Register = ADS124S08::Register;
@@ -35,11 +35,11 @@ TEST(REF_Test, constructor_InitializesFieldsCorrectly_FromRegister) {
 
 	for (const auto &testCase : testCases) {
 		const REF &ref = REF(testCase.first);
-		EXPECT_EQ(testCase.second[0], ref.FL_REF_EN);
-		EXPECT_EQ(testCase.second[1], ref.REFP_BUF);
-		EXPECT_EQ(testCase.second[2], ref.REFN_BUF);
-		EXPECT_EQ(testCase.second[3], ref.REFSEL);
-		EXPECT_EQ(testCase.second[4], ref.REFCON);
+		EXPECT_EQ(testCase.second[0], REF::FL_REF_EN::unpack(ref.reg));
+		EXPECT_EQ(testCase.second[1], REF::REFP_BUF::unpack(ref.reg));
+		EXPECT_EQ(testCase.second[2], REF::REFN_BUF::unpack(ref.reg));
+		EXPECT_EQ(testCase.second[3], REF::REFSEL::unpack(ref.reg));
+		EXPECT_EQ(testCase.second[4], REF::REFCON::unpack(ref.reg));
 	}
 }
 
@@ -166,6 +166,18 @@ TEST(
 	EXPECT_NE(0b1u, (ref.toRegister() >> 4u) & 0x01u);
 }
 
+TEST(REF_Test, getReferenceInputSelectionReturnsFieldValue) {
+	for (const auto sel : {
+			 REF::InternalReferenceSelect::REFP0_REFN0,
+			 REF::InternalReferenceSelect::REFP1_REFN0,
+			 REF::InternalReferenceSelect::INTERNAL,
+		 }) {
+		REF ref{};
+		ref.setReferenceInputSelection(sel);
+		EXPECT_EQ(sel, ref.getReferenceInputSelection());
+	}
+}
+
 TEST(REF_Test, setInternalReferenceVoltageConfigSetsFieldCorrectly) {
 	REF	 ref(0x00u);
 	auto refcon = [](Register r) { return (r >> 0U) & 0x03u; };
@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+using Address	  = ADS124S08::Address;
+using Register	  = ADS124S08::Register;
+using INPMUX	  = ADS124S08::INPMUX;
+using PGA		  = ADS124S08::PGA;
+using DATARATE	  = ADS124S08::DATARATE;
+using InputSelect = ADS124S08::INPMUX::InputSelect;
+
+template <uint8_t SHIFT, uint8_t WIDTH>
+using RegisterField = ADS124S08::RegisterField<SHIFT, WIDTH>;
+
+// Descriptors are usable in constant expressions
+static_assert(INPMUX::Descriptor::address == Address::INP_MUX);
+static_assert(INPMUX::Descriptor::pack(InputSelect::AIN3, InputSelect::AINCOM) == 0x3Cu);
+static_assert(
+	DATARATE::Descriptor::pack(
+		DATARATE::ChopperEnable::DISABLED,
+		DATARATE::ClockSelect::INTERNAL,
+		DATARATE::ModeSelect::CONTINUOUS,
+		DATARATE::FilterSelect::LOW_LATENCY,
+		DATARATE::DataRate::RATE_4000
+	) == 0x1Du
+);
+
+TEST(RegisterDescriptor_Test, fieldPacksAndUnpacksWithinMask) {
+	using Field = RegisterField<3u, 2u>;
+
+	EXPECT_EQ(Field::mask, 0x18u);
+	EXPECT_EQ(Field::pack(0b11u), 0x18u);
+	EXPECT_EQ(Field::pack(0b111u), 0x18u); // Excess bits discarded
+	EXPECT_EQ(Field::unpack(0xFFu), 0b11u);
+	EXPECT_EQ(Field::insert(0xA5u, 0b10u), 0xB5u);
+}
+
+template <typename REGISTER> static void expectDescriptorMatches(void) {
+	const REGISTER					 reg{};
+	const ADS124S08::SPI_Register_I &interface = reg;
+
+	EXPECT_EQ(interface.getAddress(), REGISTER::Descriptor::address);
+	EXPECT_EQ(interface.getResetValue(), REGISTER::Descriptor::resetValue);
+}
+
+TEST(RegisterDescriptor_Test, descriptorsMatchRegisterStructs) {
+	expectDescriptorMatches<ADS124S08::ID>();
+	expectDescriptorMatches<ADS124S08::STATUS>();
+	expectDescriptorMatches<INPMUX>();
+	expectDescriptorMatches<PGA>();
+	expectDescriptorMatches<DATARATE>();
+	expectDescriptorMatches<ADS124S08::REF>();
+	expectDescriptorMatches<ADS124S08::SYS>();
+}
+
+TEST(RegisterDescriptor_Test, fieldsCoverWholeRegister) {
+	EXPECT_EQ(INPMUX::Descriptor::fieldMask, 0xFFu);
+	EXPECT_EQ(PGA::Descriptor::fieldMask, 0xFFu);
+	EXPECT_EQ(DATARATE::Descriptor::fieldMask, 0xFFu);
+	EXPECT_EQ(ADS124S08::REF::Descriptor::fieldMask, 0xFFu);
+	EXPECT_EQ(ADS124S08::SYS::Descriptor::fieldMask, 0xFFu);
+	EXPECT_EQ(ADS124S08::ID::Descriptor::fieldMask, 0x07u);
+}
+
+TEST(RegisterDescriptor_Test, packMatchesToRegister) {
+	const PGA pga =
+		PGA().setDelay(PGA::CONVERSION_DELAY::DELAY_256).setGain(PGA::GAIN_SELECT::GAIN_16);
+
+	EXPECT_EQ(
+		PGA::Descriptor::pack(
+			PGA::CONVERSION_DELAY::DELAY_256,
+			PGA::ENABLE::ENABLED,
+			PGA::GAIN_SELECT::GAIN_16
+		),
+		pga.toRegister()
+	);
+}
+
+TEST(RegisterDescriptor_Test, registersAreConstantExpressions) {
+	static constexpr ADS124S08::SYS sys = ADS124S08::SYS().setSendStatus(true).setCRCEnable(true);
+	static constexpr ADS124S08::REF ref = ADS124S08::REF().setReferenceInputSelection(
+		ADS124S08::REF::InternalReferenceSelect::INTERNAL
+	);
+	static constexpr DATARATE datarate = DATARATE().setDataRate(DATARATE::DataRate::RATE_1000);
+
+	static_assert(sys.value() == 0x13u);
+	static_assert(sys.crc() && sys.sendStat());
+	static_assert(ref.value() == 0x38u);
+	static_assert(datarate.getDataRate() == DATARATE::DataRate::RATE_1000);
+	static_assert(ADS124S08::STATUS(0x40u).get_RDY() == ADS124S08::STATUS::Dev_RDY::NOT_READY);
+
+	EXPECT_EQ(sys.toRegister(), sys.value());
+	EXPECT_EQ(ref.toRegister(), ref.value());
+}
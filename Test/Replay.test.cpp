@@ -0,0 +1,224 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <vector>
+
+using Register	   = ADS124S08::Register;
+using Address	   = ADS124S08::Address;
+using RecordingSPI = ADS124S08::RecordingSPI;
+using ReplaySPI	   = ADS124S08::ReplaySPI;
+
+static bool appendLog(void *context, const Register *data, std::size_t count) noexcept {
+	auto *const log = static_cast<std::vector<Register> *>(context);
+	log->insert(log->end(), data, data + count);
+	return true;
+}
+
+static float rampInput(void *, Register, uint64_t nanoseconds) noexcept {
+	return static_cast<float>(nanoseconds % 1000000u) * 1.0e-6f;
+}
+
+/**
+ * @brief The session recorded and replayed: configure, convert and read back `count` samples.
+ */
+static std::vector<uint32_t> session(ADS124S08 &adc, ADS124S08::Simulator *simulator, int count) {
+	std::vector<uint32_t> samples{};
+	adc.setRegister(ADS124S08::SYS{}.setSendStatus(true).setCRCEnable(true));
+	adc.setRegister(ADS124S08::INPMUX{0x23u});
+	adc.start();
+
+	for (int i = 0; i < count; i++) {
+		if (simulator != nullptr) simulator->advanceToNextEvent();
+		const auto data = adc.rdata();
+		samples.push_back(data ? data->data : UINT32_MAX);
+	}
+	return samples;
+}
+
+class Replay_Test : public ::testing::Test {
+public:
+	std::vector<Register> log{};
+	std::vector<uint32_t> recorded{};
+
+	void SetUp(void) override {
+		ADS124S08::Simulator simulator{};
+		simulator.setInput(rampInput);
+
+		RecordingSPI recording{simulator, appendLog, &log};
+		ASSERT_TRUE(recording.begin());
+
+		ADS124S08 adc{recording};
+		recorded = session(adc, &simulator, 20);
+		ASSERT_FALSE(recording.failed());
+	}
+};
+
+TEST_F(Replay_Test, replaysRecordedSession) {
+	ReplaySPI replay{log.data(), log.size()};
+	ASSERT_TRUE(replay.valid());
+
+	ADS124S08  adc{replay};
+	const auto replayed = session(adc, nullptr, 20);
+
+	EXPECT_EQ(replayed, recorded);
+	EXPECT_TRUE(replay.finished());
+	EXPECT_FALSE(replay.mismatch());
+}
+
+TEST_F(Replay_Test, detectsTransmitMismatch) {
+	ReplaySPI replay{log.data(), log.size()};
+	ADS124S08 adc{replay};
+
+	adc.setRegister(ADS124S08::SYS{}.setSendStatus(true).setCRCEnable(true));
+	EXPECT_FALSE(adc.setRegister(ADS124S08::INPMUX{0x45u})); // Recorded with 0x23
+
+	ASSERT_TRUE(replay.mismatch());
+	EXPECT_EQ(replay.mismatch()->transfer, 2u); // After the constructor RREG and the SYS WREG
+	EXPECT_EQ(replay.mismatch()->offset, 2u);
+	EXPECT_EQ(replay.mismatch()->expected, 0x23u);
+	EXPECT_EQ(replay.mismatch()->actual, 0x45u);
+
+	// Every later transfer fails until rewound
+	EXPECT_FALSE(adc.start());
+	replay.rewind();
+	EXPECT_FALSE(replay.mismatch());
+	EXPECT_EQ(replay.transferCount(), 0u);
+}
+
+TEST_F(Replay_Test, detectsShapeMismatch) {
+	ReplaySPI replay{log.data(), log.size()};
+	ADS124S08 adc{replay};
+
+	EXPECT_FALSE(adc.start()); // A WREG was recorded instead
+	ASSERT_TRUE(replay.mismatch());
+	EXPECT_EQ(replay.mismatch()->expected, static_cast<Register>(ADS124S08::SPILog::Kind::WRITE));
+}
+
+TEST_F(Replay_Test, failsPastEndOfLog) {
+	ReplaySPI replay{log.data(), log.size()};
+	ADS124S08 adc{replay};
+	session(adc, nullptr, 20);
+
+	EXPECT_FALSE(adc.rdata());
+	EXPECT_TRUE(replay.mismatch());
+}
+
+TEST_F(Replay_Test, rewindLoopsLog) {
+	ReplaySPI replay{log.data(), log.size()};
+
+	for (int pass = 0; pass < 3; pass++) {
+		replay.rewind();
+		ADS124S08 adc{replay};
+		EXPECT_EQ(session(adc, nullptr, 20), recorded);
+	}
+}
+
+TEST(ReplaySPI_Test, rejectsInvalidHeader) {
+	const Register log[4u] = {'A', 'D', 'S', '1'};
+	ReplaySPI	   replay{log, sizeof(log)};
+
+	EXPECT_FALSE(replay.valid());
+	EXPECT_TRUE(replay.finished());
+	EXPECT_FALSE(replay.write(log, 1u));
+}
+
+/**
+ * @brief SPI whose transfers all fail.
+ */
+class FailingSPI final : public ADS124S08::SPI {
+public:
+	std::optional<uint8_t> read(Register *const, uint8_t) noexcept override {
+		return std::nullopt;
+	}
+	std::optional<uint8_t> write(const Register *const, uint8_t) noexcept override {
+		return std::nullopt;
+	}
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const, Register *const, uint8_t) noexcept override {
+		return std::nullopt;
+	}
+};
+
+/**
+ * @brief SPI whose transfers all succeed short by one byte.
+ */
+class ShortSPI final : public ADS124S08::SPI {
+public:
+	std::optional<uint8_t> read(Register *const, uint8_t count) noexcept override {
+		return static_cast<uint8_t>(count - 1u);
+	}
+	std::optional<uint8_t> write(const Register *const, uint8_t count) noexcept override {
+		return static_cast<uint8_t>(count - 1u);
+	}
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const, Register *const, uint8_t count) noexcept override {
+		return std::make_tuple(static_cast<uint8_t>(count - 1u), count);
+	}
+};
+
+TEST(ReplaySPI_Test, replaysTransferredCounts) {
+	std::vector<Register> log{};
+	ShortSPI			  shortSpi{};
+	RecordingSPI		  recording{shortSpi, appendLog, &log};
+	ASSERT_TRUE(recording.begin());
+
+	Register	   rx[4u] = {};
+	const Register tx[4u] = {ADS124S08::SPI::DataReadCommand::RDATA};
+	ASSERT_TRUE(recording.read(rx, 4u));
+	ASSERT_TRUE(recording.write(tx, 4u));
+	ASSERT_TRUE(recording.readWrite(tx, rx, 4u));
+
+	ReplaySPI replay{log.data(), log.size()};
+	EXPECT_EQ(replay.read(rx, 4u), 3u);
+	EXPECT_EQ(replay.write(tx, 4u), 3u);
+	EXPECT_EQ(replay.readWrite(tx, rx, 4u), std::make_tuple(uint8_t{3u}, uint8_t{4u}));
+	EXPECT_FALSE(replay.mismatch());
+	EXPECT_TRUE(replay.finished());
+}
+
+TEST(ReplaySPI_Test, recordsReadsWithoutBuffer) {
+	std::vector<Register> log{};
+	ShortSPI			  shortSpi{};
+	RecordingSPI		  recording{shortSpi, appendLog, &log};
+	ASSERT_TRUE(recording.begin());
+
+	ASSERT_TRUE(recording.read(nullptr, 4u));
+	EXPECT_EQ(log.size(), ADS124S08::SPILog::HEADER_SIZE + 2u + 1u + 4u); // Zeros received
+
+	ReplaySPI replay{log.data(), log.size()};
+	EXPECT_EQ(replay.read(nullptr, 4u), 3u);
+	EXPECT_TRUE(replay.finished());
+}
+
+TEST(ReplaySPI_Test, replaysFailures) {
+	std::vector<Register> log{};
+	FailingSPI			  failing{};
+	RecordingSPI		  recording{failing, appendLog, &log};
+	ASSERT_TRUE(recording.begin());
+
+	Register	   rx[4u] = {};
+	const Register tx[4u] = {ADS124S08::SPI::DataReadCommand::RDATA};
+	EXPECT_FALSE(recording.readWrite(tx, rx, 4u));
+	EXPECT_EQ(log.size(), ADS124S08::SPILog::HEADER_SIZE + 2u + 4u); // No received bytes
+
+	ReplaySPI replay{log.data(), log.size()};
+	EXPECT_FALSE(replay.readWrite(tx, rx, 4u));
+	EXPECT_FALSE(replay.mismatch());
+	EXPECT_TRUE(replay.finished());
+}
+
+TEST(ReplaySPI_Test, replaysDirectReads) {
+	std::vector<Register> log{};
+	ADS124S08::Simulator  simulator{};
+	RecordingSPI		  recording{simulator, appendLog, &log};
+	ASSERT_TRUE(recording.begin());
+
+	Register recorded[3u] = {};
+	ASSERT_TRUE(recording.read(recorded, 3u));
+
+	ReplaySPI replay{log.data(), log.size()};
+	Register  replayed[3u] = {0xFFu, 0xFFu, 0xFFu};
+	ASSERT_TRUE(replay.read(replayed, 3u));
+	EXPECT_TRUE(std::equal(recorded, recorded + 3u, replayed));
+}
@@ -2,7 +2,7 @@
 
 #define ADS124S08_GTEST_TESTING
 
-#include "../Src/STATUS.cpp"
+#include "ADS124S08.hpp"
 
 using STATUS   = ADS124S08::STATUS;
 using Register = ADS124S08::Register;
@@ -34,14 +34,14 @@ TEST(STATUS_Test, constructor_InitializesFieldsCorrectly_FromRegister) {
 	for (const auto &[input, expected] : testCases) {
 		SCOPED_TRACE(::testing::Message() << "Input: " << std::hex << static_cast<int>(input));
 		STATUS status{input};
-		EXPECT_EQ(expected[0], status.FL_POR);
-		EXPECT_EQ(expected[1], status.RDY);
-		EXPECT_EQ(expected[2], status.FL_P_RAILP);
-		EXPECT_EQ(expected[3], status.FL_P_RAILN);
-		EXPECT_EQ(expected[4], status.FL_N_RAILP);
-		EXPECT_EQ(expected[5], status.FL_N_RAILN);
-		EXPECT_EQ(expected[6], status.FL_REF_L1);
-		EXPECT_EQ(expected[7], status.FL_REF_L0);
+		EXPECT_EQ(expected[0], STATUS::FL_POR::unpack(status.reg));
+		EXPECT_EQ(expected[1], STATUS::RDY::unpack(status.reg));
+		EXPECT_EQ(expected[2], STATUS::FL_P_RAILP::unpack(status.reg));
+		EXPECT_EQ(expected[3], STATUS::FL_P_RAILN::unpack(status.reg));
+		EXPECT_EQ(expected[4], STATUS::FL_N_RAILP::unpack(status.reg));
+		EXPECT_EQ(expected[5], STATUS::FL_N_RAILN::unpack(status.reg));
+		EXPECT_EQ(expected[6], STATUS::FL_REF_L1::unpack(status.reg));
+		EXPECT_EQ(expected[7], STATUS::FL_REF_L0::unpack(status.reg));
 	}
 }
 
@@ -2,7 +2,7 @@
 
 #define ADS124S08_GTEST_TESTING
 
-#include "../Src/SYS.cpp"
+#include "ADS124S08.hpp"
 
 using SYS	   = ADS124S08::SYS;
 using Register = ADS124S08::Register;
@@ -30,11 +30,11 @@ TEST(SYS_Test, constructor_InitializesFieldsCorrectly_FromRegister) {
 
 	for (const auto &testCase : testCases) {
 		const SYS &sys = SYS(testCase.first);
-		EXPECT_EQ(testCase.second[0], sys.SYS_MON);
-		EXPECT_EQ(testCase.second[1], sys.CAL_SAMP);
-		EXPECT_EQ(testCase.second[2], sys.TIMEOUT);
-		EXPECT_EQ(testCase.second[3], sys.CRC_EN);
-		EXPECT_EQ(testCase.second[4], sys.SENDSTAT);
+		EXPECT_EQ(testCase.second[0], SYS::SYS_MON::unpack(sys.reg));
+		EXPECT_EQ(testCase.second[1], SYS::CAL_SAMP::unpack(sys.reg));
+		EXPECT_EQ(testCase.second[2], SYS::TIMEOUT::unpack(sys.reg));
+		EXPECT_EQ(testCase.second[3], SYS::CRC_EN::unpack(sys.reg));
+		EXPECT_EQ(testCase.second[4], SYS::SENDSTAT::unpack(sys.reg));
 	}
 }
 
@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <thread>
+
+using RDATA = ADS124S08::RDATA;
+
+template <std::size_t CAPACITY> using SampleQueue = ADS124S08::SampleQueue<CAPACITY>;
+
+static RDATA makeSample(uint32_t data) {
+	RDATA sample;
+	sample.status = std::nullopt;
+	sample.data	  = data;
+	sample.crc	  = std::nullopt;
+	return sample;
+}
+
+TEST(SampleQueue_Test, newQueueIsEmpty) {
+	SampleQueue<4u> queue;
+
+	EXPECT_TRUE(queue.empty());
+	EXPECT_EQ(0u, queue.size());
+	EXPECT_EQ(4u, queue.capacity());
+	EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(SampleQueue_Test, popReturnsSamplesInPushOrder) {
+	SampleQueue<8u> queue;
+
+	for (uint32_t i = 0u; i < 5u; i++) {
+		EXPECT_TRUE(queue.push(makeSample(i)));
+	}
+	EXPECT_EQ(5u, queue.size());
+
+	for (uint32_t i = 0u; i < 5u; i++) {
+		const auto sample = queue.pop();
+		ASSERT_TRUE(sample.has_value());
+		EXPECT_EQ(i, sample->data);
+	}
+	EXPECT_TRUE(queue.empty());
+}
+
+TEST(SampleQueue_Test, pushFailsWhenFull) {
+	SampleQueue<4u> queue;
+
+	for (uint32_t i = 0u; i < 4u; i++) {
+		EXPECT_TRUE(queue.push(makeSample(i)));
+	}
+	EXPECT_FALSE(queue.push(makeSample(4u)));
+
+	EXPECT_EQ(0u, queue.pop()->data);
+	EXPECT_TRUE(queue.push(makeSample(4u)));
+}
+
+TEST(SampleQueue_Test, indicesWrapAroundCapacity) {
+	SampleQueue<4u> queue;
+
+	for (uint32_t i = 0u; i < 19u; i++) {
+		ASSERT_TRUE(queue.push(makeSample(i)));
+		const auto sample = queue.pop();
+		ASSERT_TRUE(sample.has_value());
+		EXPECT_EQ(i, sample->data);
+	}
+}
+
+TEST(SampleQueue_Test, bulkPopReturnsAvailableSamples) {
+	SampleQueue<8u> queue;
+	RDATA			samples[8u];
+
+	for (uint32_t i = 0u; i < 3u; i++) {
+		queue.push(makeSample(i));
+	}
+
+	EXPECT_EQ(2u, queue.pop(samples, 2u));
+	EXPECT_EQ(0u, samples[0].data);
+	EXPECT_EQ(1u, samples[1].data);
+
+	EXPECT_EQ(1u, queue.pop(samples, 8u));
+	EXPECT_EQ(2u, samples[0].data);
+
+	EXPECT_EQ(0u, queue.pop(samples, 8u));
+}
+
+TEST(SampleQueue_Test, concurrentProducerAndConsumerPreserveOrder) {
+	static constexpr uint32_t SAMPLE_COUNT = 100000u;
+
+	SampleQueue<64u> queue;
+
+	std::thread producer([&queue]() {
+		for (uint32_t i = 0u; i < SAMPLE_COUNT;) {
+			if (queue.push(makeSample(i))) i++;
+			else std::this_thread::yield();
+		}
+	});
+
+	uint32_t expected = 0u;
+	while (expected < SAMPLE_COUNT) {
+		const auto sample = queue.pop();
+		if (sample) {
+			ASSERT_EQ(expected, sample->data);
+			expected++;
+		} else std::this_thread::yield();
+	}
+
+	producer.join();
+	EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,234 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using Register	  = ADS124S08::Register;
+using ScanChannel = ADS124S08::ScanChannel;
+using InputSelect = ADS124S08::INPMUX::InputSelect;
+
+/**
+ * @brief Transport emulating the register file. Each conversion returns the INPMUX value.
+ */
+class RegisterFileSPI : public ADS124S08::SPI {
+public:
+	std::array<Register, ADS124S08::REGISTER_COUNT> registers{
+		0x00u, 0x80u, 0x01u, 0x00u, 0x14u, 0x10u, 0x00u, 0xFFu, 0x00u,
+		0x10u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x40u, 0x00u, 0x00u,
+	};
+	uint32_t wregBytes{0u};
+	uint32_t wregCount{0u};
+	uint32_t startCount{0u};
+	bool	 failConversions{false};
+
+	std::optional<uint8_t> read(Register *const, uint8_t) noexcept override { return std::nullopt; }
+
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept override {
+		if ((buffer[0] & 0xE0u) == 0x40u) {
+			const uint8_t address = buffer[0] & 0x1Fu;
+			std::copy_n(&buffer[2], buffer[1] + 1u, &registers[address]);
+			wregBytes += count;
+			wregCount++;
+		} else if (buffer[0] == static_cast<Register>(SPI::ControlCommand::START)) {
+			startCount++;
+		}
+		return count;
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const txBuffer, Register *const rxBuffer, uint8_t count) noexcept
+		override {
+		std::fill_n(rxBuffer, count, 0xFFu);
+		if ((txBuffer[0] & 0xE0u) == 0x20u) {
+			const uint8_t address = txBuffer[0] & 0x1Fu;
+			std::copy_n(&registers[address], txBuffer[1] + 1u, &rxBuffer[2]);
+		} else if (txBuffer[0] == static_cast<Register>(SPI::DataReadCommand::RDATA)) {
+			if (failConversions) return std::nullopt;
+			rxBuffer[1] = 0x00u;
+			rxBuffer[2] = 0x00u;
+			rxBuffer[3] = registers[0x02u];
+		}
+		return std::make_tuple(count, count);
+	}
+};
+
+static ScanChannel makeChannel(InputSelect positive, Register pga = 0x00u, Register dr = 0x14u) {
+	ScanChannel channel{};
+	channel.inpmux	 = ADS124S08::INPMUX(positive, InputSelect::AINCOM);
+	channel.pga		 = ADS124S08::PGA(pga);
+	channel.datarate = ADS124S08::DATARATE(dr);
+	return channel;
+}
+
+static bool countWaits(void *context) noexcept {
+	(*static_cast<uint32_t *>(context))++;
+	return true;
+}
+
+static bool failWaits(void *) noexcept { return false; }
+
+static bool readyWaits(void *) noexcept { return true; }
+
+class ScanSequencer_Test : public ::testing::Test {
+public:
+	RegisterFileSPI spi{};
+	ADS124S08		adc{spi};
+};
+
+TEST_F(ScanSequencer_Test, scanReportsResultsInChannelOrder) {
+	const ScanChannel channels[] = {
+		makeChannel(InputSelect::AIN0, 0x08u),
+		makeChannel(InputSelect::AIN1),
+		makeChannel(InputSelect::AIN2, 0x08u),
+		makeChannel(InputSelect::AIN3),
+	};
+	ADS124S08::ScanSequencer<8u> sequencer{adc, channels, 4u};
+
+	std::optional<ADS124S08::RDATA> results[4u];
+	uint32_t						waits = 0u;
+	EXPECT_EQ(sequencer.scan(results, countWaits, &waits), 4u);
+	EXPECT_EQ(waits, 4u);
+
+	for (std::size_t i = 0u; i < 4u; i++) {
+		ASSERT_TRUE(results[i].has_value());
+		EXPECT_EQ(results[i]->data, channels[i].inpmux.toRegister());
+	}
+}
+
+TEST_F(ScanSequencer_Test, reorderGroupsChannelsBySharedSettings) {
+	// Alternating gains force a 2-register WREG on every step unless reordered
+	const ScanChannel channels[] = {
+		makeChannel(InputSelect::AIN0, 0x08u),
+		makeChannel(InputSelect::AIN1),
+		makeChannel(InputSelect::AIN2, 0x08u),
+		makeChannel(InputSelect::AIN3),
+	};
+	ADS124S08::ScanSequencer<4u> inOrder{
+		adc, channels, 4u, ADS124S08::DataReadMode::COMMAND, false
+	};
+	ADS124S08::ScanSequencer<4u> reordered{adc, channels, 4u};
+
+	EXPECT_EQ(inOrder.cycleCost(), 4u * 4u);
+	EXPECT_EQ(reordered.cycleCost(), 2u * 4u + 2u * 3u);
+
+	for (std::size_t position = 0u; position < 4u; position += 2u) {
+		const auto first  = reordered.channelAt(position);
+		const auto second = reordered.channelAt(position + 1u);
+		EXPECT_EQ(first % 2u, second % 2u);
+	}
+}
+
+TEST_F(ScanSequencer_Test, scanWritesOnlyDifferingRegisters) {
+	const ScanChannel channels[] = {
+		makeChannel(InputSelect::AIN0),
+		makeChannel(InputSelect::AIN1),
+	};
+	ADS124S08::ScanSequencer<2u> sequencer{adc, channels, 2u};
+
+	std::optional<ADS124S08::RDATA> results[2u * 3u];
+	EXPECT_EQ(sequencer.run(results, 3u, readyWaits), 6u);
+
+	// The first channel differs from the reset state in INPMUX only
+	EXPECT_EQ(spi.wregCount, 6u);
+	EXPECT_EQ(spi.wregBytes, 6u * 3u);
+	EXPECT_EQ(results[4]->data, 0x0Cu);
+	EXPECT_EQ(results[5]->data, 0x1Cu);
+}
+
+TEST_F(ScanSequencer_Test, singleChannelIsWrittenOnce) {
+	const ScanChannel channels[] = {makeChannel(InputSelect::AIN5)};
+	ADS124S08::ScanSequencer<1u> sequencer{adc, channels, 1u};
+
+	std::optional<ADS124S08::RDATA> results[4u];
+	EXPECT_EQ(sequencer.run(results, 4u, readyWaits), 4u);
+	EXPECT_EQ(spi.wregCount, 1u);
+	EXPECT_EQ(spi.startCount, 0u);
+}
+
+TEST_F(ScanSequencer_Test, singleShotChannelsSendStart) {
+	const ScanChannel channels[] = {
+		makeChannel(InputSelect::AIN0, 0x00u, 0x34u),
+		makeChannel(InputSelect::AIN1, 0x00u, 0x34u),
+	};
+	ADS124S08::ScanSequencer<2u> sequencer{adc, channels, 2u};
+
+	std::optional<ADS124S08::RDATA> results[2u];
+	EXPECT_EQ(sequencer.scan(results, readyWaits), 2u);
+	EXPECT_EQ(spi.startCount, 2u);
+}
+
+TEST_F(ScanSequencer_Test, failedWaitOrReadFailsOnlyThatChannel) {
+	const ScanChannel channels[] = {
+		makeChannel(InputSelect::AIN0),
+		makeChannel(InputSelect::AIN1),
+	};
+	ADS124S08::ScanSequencer<2u> sequencer{adc, channels, 2u};
+
+	std::optional<ADS124S08::RDATA> results[2u];
+	EXPECT_EQ(sequencer.scan(results, failWaits, nullptr), 0u);
+	EXPECT_FALSE(results[0].has_value());
+	EXPECT_FALSE(results[1].has_value());
+
+	spi.failConversions = true;
+	EXPECT_EQ(sequencer.scan(results, readyWaits), 0u);
+}
+
+TEST_F(ScanSequencer_Test, scanRequiresWaitHook) {
+	const ScanChannel channels[] = {makeChannel(InputSelect::AIN0)};
+	ADS124S08::ScanSequencer<1u> sequencer{adc, channels, 1u};
+
+	// Reading without waiting would return the conversion of the previous configuration
+	std::optional<ADS124S08::RDATA> results[1u];
+	EXPECT_EQ(sequencer.scan(results, nullptr), 0u);
+	EXPECT_EQ(sequencer.run(results, 1u, nullptr), 0u);
+	EXPECT_EQ(spi.wregCount, 0u);
+}
+
+TEST_F(ScanSequencer_Test, countIsLimitedToCapacity) {
+	const ScanChannel channels[] = {
+		makeChannel(InputSelect::AIN0),
+		makeChannel(InputSelect::AIN1),
+		makeChannel(InputSelect::AIN2),
+	};
+	ADS124S08::ScanSequencer<2u> sequencer{adc, channels, 3u};
+	EXPECT_EQ(sequencer.size(), 2u);
+
+	ADS124S08::ScanSequencer<2u> empty{adc, nullptr, 3u};
+	EXPECT_EQ(empty.size(), 0u);
+}
+
+TEST_F(ScanSequencer_Test, cycleTimeUsesSettlingLatencyOnChannelChanges) {
+	const ScanChannel channels[] = {
+		makeChannel(InputSelect::AIN0, 0x00u, 0x1Du), // DELAY_14, 4000 SPS low-latency
+		makeChannel(InputSelect::AIN1, 0x00u, 0x1Du),
+	};
+	ADS124S08::ScanSequencer<2u> pair{adc, channels, 2u};
+	EXPECT_EQ(pair.cycleTime(), 2u * (14u + 64u));
+
+	ADS124S08::ScanSequencer<2u> single{adc, channels, 1u};
+	EXPECT_EQ(single.cycleTime(), 64u);
+}
+
+// Built entirely at compile time
+static constexpr ScanChannel CONSTANT_CHANNELS[] = {
+	{ADS124S08::INPMUX(InputSelect::AIN0, InputSelect::AINCOM),
+	 ADS124S08::PGA().setGain(ADS124S08::PGA::GAIN_SELECT::GAIN_8)},
+	{ADS124S08::INPMUX(InputSelect::AIN1, InputSelect::AINCOM),
+	 ADS124S08::PGA(),
+	 ADS124S08::DATARATE().setFilter(ADS124S08::DATARATE::FilterSelect::SINC3)},
+};
+static_assert(CONSTANT_CHANNELS[0].inpmux.value() == 0x0Cu);
+static_assert(CONSTANT_CHANNELS[0].pga.value() == 0x0Bu);
+static_assert(CONSTANT_CHANNELS[1].datarate.value() == 0x04u);
+
+TEST_F(ScanSequencer_Test, scansConstantChannelTables) {
+	ADS124S08::ScanSequencer<2u> sequencer{adc, CONSTANT_CHANNELS, 2u};
+
+	std::optional<ADS124S08::RDATA> results[2u];
+	EXPECT_EQ(sequencer.scan(results, readyWaits), 2u);
+	EXPECT_EQ(results[0]->data, 0x0Cu);
+	EXPECT_EQ(results[1]->data, 0x1Cu);
+	EXPECT_EQ(spi.registers[0x03u], 0x00u); // The last channel scanned bypasses the PGA
+}
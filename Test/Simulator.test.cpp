@@ -0,0 +1,240 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+using Register	   = ADS124S08::Register;
+using Address	   = ADS124S08::Address;
+using Simulator	   = ADS124S08::Simulator;
+using LatencyModel = ADS124S08::LatencyModel;
+
+static float constantInput(void *context, Register, uint64_t) noexcept {
+	return *static_cast<const float *>(context);
+}
+
+static void countDataReady(void *context) noexcept { (*static_cast<uint32_t *>(context))++; }
+
+static uint64_t firstSampleNanoseconds(const Simulator &simulator) {
+	const auto latency = LatencyModel::compute(
+		ADS124S08::PGA{simulator.registerValue(Address::PGA)},
+		ADS124S08::DATARATE{simulator.registerValue(Address::DATA_RATE)}
+	);
+	return LatencyModel::nanoseconds(latency.firstSample);
+}
+
+static uint64_t periodNanoseconds(const Simulator &simulator) {
+	const auto latency = LatencyModel::compute(
+		ADS124S08::PGA{simulator.registerValue(Address::PGA)},
+		ADS124S08::DATARATE{simulator.registerValue(Address::DATA_RATE)}
+	);
+	return LatencyModel::nanoseconds(latency.period);
+}
+
+TEST(Simulator_Test, driverReadsResetRegisters) {
+	Simulator simulator{};
+	ADS124S08 adc{simulator};
+
+	Register registers[ADS124S08::REGISTER_COUNT] = {};
+	ASSERT_TRUE(adc.rreg(Address::ID, ADS124S08::REGISTER_COUNT, registers));
+
+	for (uint8_t i = 0u; i < ADS124S08::REGISTER_COUNT; i++) {
+		EXPECT_EQ(registers[i], ADS124S08::RESET_VALUES[i]) << "register " << int{i};
+	}
+}
+
+TEST(Simulator_Test, wregIsReadBack) {
+	Simulator simulator{};
+	ADS124S08 adc{simulator};
+
+	const auto datarate =
+		ADS124S08::DATARATE{}.setDataRate(ADS124S08::DATARATE::DataRate::RATE_4000);
+	ASSERT_TRUE(adc.setRegister(datarate));
+	EXPECT_EQ(simulator.registerValue(Address::DATA_RATE), datarate.toRegister());
+
+	// A second driver has no cache to satisfy the read from
+	ADS124S08 other{simulator};
+	EXPECT_EQ(other.rreg(Address::DATA_RATE), datarate.toRegister());
+}
+
+TEST(Simulator_Test, idIsReadOnlyAndStatusOnlyClearsPor) {
+	Simulator::Configuration configuration = Simulator::Configuration::defaults();
+	configuration.id						 = 0x05u;
+	Simulator simulator{configuration};
+
+	const Register writes[2u] = {0xFFu, 0x00u};
+	const Register frame[4u]  = {0x40u | Address::ID, 0x01u, writes[0], writes[1]};
+	ASSERT_TRUE(simulator.write(frame, sizeof(frame)));
+
+	EXPECT_EQ(simulator.registerValue(Address::ID), 0x05u);
+	EXPECT_EQ(simulator.registerValue(Address::STATUS), 0x00u);
+}
+
+TEST(Simulator_Test, conversionsFollowLatencyModel) {
+	Simulator simulator{};
+	ADS124S08 adc{simulator};
+
+	EXPECT_FALSE(simulator.advanceToNextEvent());
+	ASSERT_TRUE(adc.start());
+	EXPECT_TRUE(simulator.converting());
+	EXPECT_FALSE(simulator.dataReady());
+
+	const uint64_t first = firstSampleNanoseconds(simulator);
+	ASSERT_TRUE(simulator.advanceToNextEvent());
+	EXPECT_EQ(simulator.now(), first);
+	EXPECT_TRUE(simulator.dataReady());
+
+	ASSERT_TRUE(simulator.advanceToNextEvent());
+	EXPECT_EQ(simulator.now(), first + periodNanoseconds(simulator));
+	EXPECT_EQ(simulator.getStatistics().conversions, 2u);
+	EXPECT_EQ(simulator.getStatistics().overruns, 1u);
+}
+
+TEST(Simulator_Test, rdataCarriesStatusAndValidCrc) {
+	float	  volts = 1.25f;
+	Simulator simulator{};
+	simulator.setInput(constantInput, &volts);
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.setRegister(ADS124S08::SYS{}.setSendStatus(true).setCRCEnable(true)));
+	ASSERT_TRUE(adc.start());
+	simulator.advanceToNextEvent();
+
+	const auto data = adc.rdata();
+	ASSERT_TRUE(data);
+	EXPECT_EQ(data->data, 0x400000u); // Half of the positive full scale
+	ASSERT_TRUE(data->status);
+	ASSERT_TRUE(data->crc);
+	EXPECT_EQ(data->crcValid(), true);
+	EXPECT_FALSE(simulator.dataReady());
+}
+
+TEST(Simulator_Test, directReadReturnsConversion) {
+	float	  volts = -1.25f;
+	Simulator simulator{};
+	simulator.setInput(constantInput, &volts);
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.start());
+	simulator.advanceToNextEvent();
+
+	const auto data = adc.rdataDirect();
+	ASSERT_TRUE(data);
+	EXPECT_EQ(data->data, 0xC00000u);
+}
+
+TEST(Simulator_Test, pgaGainScalesInput) {
+	float	  volts = 0.125f;
+	Simulator simulator{};
+	simulator.setInput(constantInput, &volts);
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.setRegister(ADS124S08::PGA{}.setGain(ADS124S08::PGA::GAIN_SELECT::GAIN_4)));
+	ASSERT_TRUE(adc.start());
+	simulator.advanceToNextEvent();
+
+	EXPECT_EQ(simulator.latestCode(), 0x19999A); // 0.5 V of 2.5 V
+}
+
+TEST(Simulator_Test, singleShotStopsAfterOneConversion) {
+	Simulator simulator{};
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.setRegister(
+		ADS124S08::DATARATE{}.setConversionMode(ADS124S08::DATARATE::ModeSelect::SINGLE_SHOT)
+	));
+	ASSERT_TRUE(adc.start());
+
+	ASSERT_TRUE(simulator.advanceToNextEvent());
+	EXPECT_FALSE(simulator.converting());
+	EXPECT_FALSE(simulator.advanceToNextEvent());
+	EXPECT_EQ(simulator.getStatistics().conversions, 1u);
+}
+
+TEST(Simulator_Test, stopCompletesPendingConversion) {
+	Simulator simulator{};
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.start());
+	simulator.advance(firstSampleNanoseconds(simulator) / 2u);
+	ASSERT_TRUE(adc.stop());
+
+	EXPECT_TRUE(simulator.advanceToNextEvent());
+	EXPECT_FALSE(simulator.advanceToNextEvent());
+	EXPECT_EQ(simulator.getStatistics().conversions, 1u);
+}
+
+TEST(Simulator_Test, wregRestartsConversion) {
+	Simulator simulator{};
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.start());
+	simulator.advance(1000u);
+	ASSERT_TRUE(adc.setRegister(ADS124S08::INPMUX{0x12u}));
+
+	ASSERT_TRUE(simulator.advanceToNextEvent());
+	EXPECT_EQ(simulator.now(), 1000u + firstSampleNanoseconds(simulator));
+}
+
+TEST(Simulator_Test, selfOffsetCalibrationRemovesOffset) {
+	Simulator::Configuration configuration = Simulator::Configuration::defaults();
+	configuration.offsetVolts				 = 0.01f;
+	Simulator simulator{configuration};
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.start());
+	simulator.advanceToNextEvent();
+	EXPECT_NEAR(simulator.latestCode(), 33554, 1); // 10 mV of 2.5 V
+
+	ASSERT_TRUE(adc.selfOffsetCalibrate());
+	EXPECT_FALSE(simulator.converting());
+	ASSERT_TRUE(simulator.advanceToNextEvent()); // Calibration
+	EXPECT_NE(simulator.registerValue(Address::OF_CAL0), 0x00u);
+	EXPECT_TRUE(simulator.converting());
+
+	ASSERT_TRUE(simulator.advanceToNextEvent());
+	EXPECT_EQ(simulator.latestCode(), 0);
+}
+
+TEST(Simulator_Test, systemGainCalibrationScalesToFullScale) {
+	float	  volts = 2.0f;
+	Simulator simulator{};
+	simulator.setInput(constantInput, &volts);
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.gainCalibrate());
+	ASSERT_TRUE(simulator.advanceToNextEvent());
+
+	ASSERT_TRUE(adc.start());
+	simulator.advanceToNextEvent();
+	EXPECT_NEAR(simulator.latestCode(), 0x7FFFFF, 2);
+}
+
+TEST(Simulator_Test, dataReadyCallbackFiresPerConversion) {
+	uint32_t  edges = 0u;
+	Simulator simulator{};
+	simulator.setDataReadyCallback(countDataReady, &edges);
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.start());
+	simulator.advance(firstSampleNanoseconds(simulator) + 2u * periodNanoseconds(simulator));
+	EXPECT_EQ(edges, 3u);
+}
+
+TEST(Simulator_Test, transfersTakeTimeAtSclk) {
+	Simulator::Configuration configuration = Simulator::Configuration::defaults();
+	configuration.sclkHz					 = 1000000u;
+	Simulator simulator{configuration};
+
+	const Register command = ADS124S08::SPI::ControlCommand::NOP;
+	ASSERT_TRUE(simulator.write(&command, 1u));
+	EXPECT_EQ(simulator.now(), 8000u);
+	EXPECT_EQ(simulator.getStatistics().transfers, 1u);
+}
+
+TEST(Simulator_Test, resetRestoresRegisters) {
+	Simulator simulator{};
+	ADS124S08 adc{simulator};
+
+	ASSERT_TRUE(adc.setRegister(ADS124S08::INPMUX{0x34u}));
+	ASSERT_TRUE(adc.reset());
+	EXPECT_EQ(simulator.registerValue(Address::INP_MUX), ADS124S08::RESET_VALUES[Address::INP_MUX]);
+}
@@ -0,0 +1,215 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#if defined(__linux__) && __has_include(<linux/spi/spidev.h>)
+
+#include <cstdio>
+#include <unistd.h>
+#include <vector>
+
+using Register	= ADS124S08::Register;
+using Address	= ADS124S08::Address;
+using SpidevSPI = ADS124S08::SpidevSPI;
+
+/**
+ * @brief Stand-in for the spidev driver. Records each message and answers like a device whose
+ * registers read as their address and whose conversions read 0x123456.
+ */
+struct FakeSpidev {
+	struct Segment {
+		std::vector<Register> tx;
+		bool				  csChange;
+	};
+
+	static inline std::vector<std::vector<Segment>> messages{};
+	static inline std::vector<unsigned long>		configuration{};
+	static inline uint32_t							speedHz{0u};
+	static inline bool								fail{false};
+
+	static void reset(void) {
+		messages.clear();
+		configuration.clear();
+		fail = false;
+	}
+
+	static int ioctl(int, unsigned long request, void *argument) noexcept {
+		if (fail) return -1;
+
+		if (_IOC_TYPE(request) != SPI_IOC_MAGIC || _IOC_NR(request) != 0u) {
+			configuration.push_back(request);
+			if (request == SPI_IOC_WR_MAX_SPEED_HZ) speedHz = *static_cast<uint32_t *>(argument);
+			return 0;
+		}
+
+		const std::size_t count		= _IOC_SIZE(request) / sizeof(spi_ioc_transfer);
+		auto *const		  transfers = static_cast<spi_ioc_transfer *>(argument);
+
+		std::vector<Segment> message{};
+		for (std::size_t i = 0u; i < count; i++) {
+			const auto *const tx = reinterpret_cast<const Register *>(transfers[i].tx_buf);
+			auto *const		  rx = reinterpret_cast<Register *>(transfers[i].rx_buf);
+			const uint32_t	  len = transfers[i].len;
+
+			std::vector<Register> bytes(len, 0x00u);
+			if (tx != nullptr) bytes.assign(tx, tx + len);
+			message.push_back({bytes, transfers[i].cs_change != 0u});
+
+			if (rx == nullptr) continue;
+			std::fill_n(rx, len, 0x00u);
+			if ((bytes[0] & 0xE0u) == 0x20u) {
+				for (uint32_t j = 2u; j < len; j++) rx[j] = (bytes[0] & 0x1Fu) + j - 2u;
+			} else if (bytes[0] == ADS124S08::SPI::DataReadCommand::RDATA && len >= 4u) {
+				rx[1] = 0x12u;
+				rx[2] = 0x34u;
+				rx[3] = 0x56u;
+			}
+		}
+		messages.push_back(message);
+		return static_cast<int>(count);
+	}
+};
+
+class SpidevSPI_Test : public ::testing::Test {
+public:
+	void SetUp() override { FakeSpidev::reset(); }
+
+	SpidevSPI spi{3, 1000000u, FakeSpidev::ioctl};
+};
+
+TEST_F(SpidevSPI_Test, readWriteIsOneMessage) {
+	const Register tx[3u] = {0x23u, 0x00u, 0x00u};
+	Register	   rx[3u] = {0u};
+
+	ASSERT_TRUE(spi.readWrite(tx, rx, 3u).has_value());
+	ASSERT_EQ(FakeSpidev::messages.size(), 1u);
+	ASSERT_EQ(FakeSpidev::messages[0].size(), 1u);
+	EXPECT_FALSE(FakeSpidev::messages[0][0].csChange);
+	EXPECT_EQ(rx[2], 0x03u);
+	EXPECT_EQ(spi.messageCount(), 1u);
+}
+
+TEST_F(SpidevSPI_Test, batchedConfigurationAndReadShareOneMessage) {
+	ADS124S08 adc{spi};
+	adc.setSystemControl(ADS124S08::SYS{}); // No STATUS or CRC bytes
+	FakeSpidev::messages.clear();
+
+	spi.beginBatch(adc);
+	adc.setRegister(ADS124S08::INPMUX{0x12u});
+	adc.start();
+	EXPECT_TRUE(FakeSpidev::messages.empty());
+
+	const auto result = adc.rdata();
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result->data, 0x123456u);
+
+	ASSERT_EQ(FakeSpidev::messages.size(), 1u);
+	const auto &message = FakeSpidev::messages[0];
+	ASSERT_EQ(message.size(), 3u);
+	EXPECT_EQ(message[0].tx, (std::vector<Register>{0x42u, 0x00u, 0x12u}));
+	EXPECT_EQ(message[1].tx, (std::vector<Register>{0x08u}));
+	EXPECT_EQ(message[2].tx[0], 0x12u);
+	EXPECT_TRUE(message[0].csChange);
+	EXPECT_TRUE(message[1].csChange);
+	EXPECT_FALSE(message[2].csChange);
+
+	// Still batching until flushed
+	adc.stop();
+	EXPECT_EQ(FakeSpidev::messages.size(), 1u);
+	EXPECT_TRUE(spi.flush());
+	EXPECT_EQ(FakeSpidev::messages.size(), 2u);
+	EXPECT_TRUE(spi.flush()); // Nothing queued
+	EXPECT_EQ(FakeSpidev::messages.size(), 2u);
+}
+
+TEST_F(SpidevSPI_Test, queuedWritesAreCopied) {
+	ADS124S08 adc{spi};
+	FakeSpidev::messages.clear();
+
+	spi.beginBatch(adc);
+	Register command = 0x0Au; // STOP
+	spi.write(&command, 1u);
+	command = 0x08u;
+	spi.write(&command, 1u);
+	spi.flush();
+
+	ASSERT_EQ(FakeSpidev::messages.size(), 1u);
+	EXPECT_EQ(FakeSpidev::messages[0][0].tx, (std::vector<Register>{0x0Au}));
+	EXPECT_EQ(FakeSpidev::messages[0][1].tx, (std::vector<Register>{0x08u}));
+}
+
+TEST_F(SpidevSPI_Test, fullQueueIsSubmitted) {
+	const Register command = 0x08u;
+	ADS124S08	   adc{spi};
+	FakeSpidev::messages.clear();
+
+	spi.beginBatch(adc);
+	for (uint8_t i = 0u; i < SpidevSPI::MAX_SEGMENTS + 1u; i++) spi.write(&command, 1u);
+	spi.flush();
+
+	ASSERT_EQ(FakeSpidev::messages.size(), 2u);
+	EXPECT_EQ(FakeSpidev::messages[0].size(), SpidevSPI::MAX_SEGMENTS);
+	EXPECT_EQ(FakeSpidev::messages[1].size(), 1u);
+}
+
+TEST_F(SpidevSPI_Test, segmentsAreSentTogether) {
+	const Register rdata[4u] = {0x12u, 0x00u, 0x00u, 0x00u};
+	Register	   first[4u] = {0u};
+	Register	   second[4u] = {0u};
+
+	const SpidevSPI::Segment segments[2u] = {{rdata, first, 4u}, {rdata, second, 4u}};
+	EXPECT_TRUE(spi.transfer(segments, 2u));
+	EXPECT_EQ(FakeSpidev::messages.size(), 1u);
+	EXPECT_EQ(second[3], 0x56u);
+
+	EXPECT_FALSE(spi.transfer(segments, SpidevSPI::MAX_SEGMENTS + 1u));
+}
+
+TEST_F(SpidevSPI_Test, failuresAreReported) {
+	FakeSpidev::fail = true;
+
+	Register buffer[2u] = {0u};
+	EXPECT_FALSE(spi.read(buffer, 2u).has_value());
+	EXPECT_FALSE(spi.write(buffer, 2u).has_value());
+
+	FakeSpidev::fail = false;
+	ADS124S08 adc{spi};
+	adc.setSystemControl(ADS124S08::SYS{});
+	FakeSpidev::fail = true;
+
+	spi.beginBatch(adc);
+	EXPECT_TRUE(spi.write(buffer, 2u).has_value()); // Queued
+	EXPECT_TRUE(adc.setRegister(ADS124S08::INPMUX{0x12u}));
+	EXPECT_EQ(adc.getCachedRegister(Address::INP_MUX), 0x12u);
+
+	// The driver cached the queued WREG, which never reached the device
+	EXPECT_FALSE(spi.flush());
+	EXPECT_FALSE(adc.getCachedRegister(Address::INP_MUX).has_value());
+	EXPECT_FALSE(adc.getCachedRegister(Address::SYS).has_value());
+}
+
+TEST_F(SpidevSPI_Test, openConfiguresDevice) {
+	char path[] = "/tmp/spidevXXXXXX";
+	const int stand = mkstemp(path);
+	ASSERT_GE(stand, 0);
+
+	const int fd = SpidevSPI::open(path, 2000000u, FakeSpidev::ioctl);
+	ASSERT_GE(fd, 0);
+	EXPECT_EQ(
+		FakeSpidev::configuration,
+		(std::vector<unsigned long>{
+			SPI_IOC_WR_MODE, SPI_IOC_WR_BITS_PER_WORD, SPI_IOC_WR_MAX_SPEED_HZ
+		})
+	);
+	EXPECT_EQ(FakeSpidev::speedHz, 2000000u);
+
+	FakeSpidev::fail = true;
+	EXPECT_EQ(SpidevSPI::open(path, 2000000u, FakeSpidev::ioctl), -1);
+	EXPECT_EQ(SpidevSPI::open("/nonexistent/spidev", 2000000u, FakeSpidev::ioctl), -1);
+
+	close(fd);
+	close(stand);
+	unlink(path);
+}
+
+#endif
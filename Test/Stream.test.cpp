@@ -0,0 +1,118 @@
+#include "gtest/gtest.h"
+
+#include "ADS124S08.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using Register = ADS124S08::Register;
+
+/**
+ * @brief Minimal transport producing an incrementing conversion code for every RDATA.
+ */
+class CountingSPI : public ADS124S08::SPI {
+public:
+	std::vector<Register> commands{};
+	uint32_t			  nextCode{0u};
+	bool				  failReads{false};
+
+	std::optional<uint8_t> read(Register *const buffer, uint8_t count) noexcept override {
+		if (failReads) return std::nullopt;
+		std::fill_n(buffer, count, 0u);
+		if (count >= 3u) {
+			buffer[count - 3u] = static_cast<Register>(nextCode >> 16u);
+			buffer[count - 2u] = static_cast<Register>(nextCode >> 8u);
+			buffer[count - 1u] = static_cast<Register>(nextCode);
+		}
+		nextCode++;
+		return count;
+	}
+
+	std::optional<uint8_t> write(const Register *const buffer, uint8_t count) noexcept override {
+		commands.push_back(buffer[0]);
+		return count;
+	}
+
+	std::optional<std::tuple<uint8_t, uint8_t>>
+	readWrite(const Register *const txBuffer, Register *const rxBuffer, uint8_t count) noexcept
+		override {
+		write(txBuffer, count);
+		if (!read(rxBuffer, count)) return std::nullopt;
+		return std::make_tuple(count, count);
+	}
+};
+
+class Stream_Test : public ::testing::Test {
+public:
+	CountingSPI spi{};
+	ADS124S08	adc{spi};
+
+	void SetUp() override {
+		spi.commands.clear();
+		spi.nextCode = 0u;
+	}
+};
+
+TEST_F(Stream_Test, startAndStopSendCommands) {
+	ADS124S08::Stream<4u> stream{adc};
+
+	EXPECT_TRUE(stream.start().has_value());
+	EXPECT_TRUE(stream.stop().has_value());
+
+	ASSERT_EQ(2u, spi.commands.size());
+	EXPECT_EQ(ADS124S08::SPI::START, spi.commands[0]);
+	EXPECT_EQ(ADS124S08::SPI::STOP, spi.commands[1]);
+}
+
+TEST_F(Stream_Test, onDataReadyQueuesConversions) {
+	ADS124S08::Stream<8u> stream{adc};
+
+	for (uint32_t i = 0u; i < 5u; i++) {
+		EXPECT_TRUE(stream.onDataReady());
+	}
+
+	for (uint32_t i = 0u; i < 5u; i++) {
+		const auto sample = stream.samples().pop();
+		ASSERT_TRUE(sample.has_value());
+		EXPECT_EQ(i, sample->data);
+	}
+
+	EXPECT_EQ(5u, stream.getStatistics().samples);
+	EXPECT_EQ(0u, stream.getStatistics().overruns);
+}
+
+TEST_F(Stream_Test, directReadModeSendsOnlyNops) {
+	ADS124S08::Stream<4u> stream{adc, ADS124S08::DataReadMode::DIRECT};
+
+	EXPECT_TRUE(stream.onDataReady());
+	EXPECT_TRUE(stream.onDataReady());
+
+	ASSERT_EQ(2u, spi.commands.size());
+	EXPECT_EQ(ADS124S08::SPI::NOP, spi.commands[0]);
+	EXPECT_EQ(ADS124S08::SPI::NOP, spi.commands[1]);
+	EXPECT_EQ(0u, stream.samples().pop()->data);
+}
+
+TEST_F(Stream_Test, onDataReadyCountsOverrunsWhenQueueFull) {
+	ADS124S08::Stream<2u> stream{adc};
+
+	EXPECT_TRUE(stream.onDataReady());
+	EXPECT_TRUE(stream.onDataReady());
+	EXPECT_FALSE(stream.onDataReady());
+
+	EXPECT_EQ(2u, stream.getStatistics().samples);
+	EXPECT_EQ(1u, stream.getStatistics().overruns);
+	// The dropped conversion was still read from the device
+	EXPECT_EQ(3u, spi.nextCode);
+}
+
+TEST_F(Stream_Test, onDataReadyCountsReadFailures) {
+	ADS124S08::Stream<2u> stream{adc};
+
+	spi.failReads = true;
+	EXPECT_FALSE(stream.onDataReady());
+
+	EXPECT_EQ(0u, stream.getStatistics().samples);
+	EXPECT_EQ(1u, stream.getStatistics().readFailures);
+	EXPECT_TRUE(stream.samples().empty());
+}